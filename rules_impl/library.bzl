@@ -182,6 +182,8 @@ def add_library(name, **kwargs):
 
         # tasks/components/containers
         "//mediapipe/tasks/cc/components/containers/proto:landmarks_detection_result_cc_proto",
+        "//mediapipe/tasks/cc/metadata:metadata_extractor",
+        "//mediapipe/util:label_map_util",
 
         # tasks/audio:audio_classifier
         "//mediapipe/tasks/cc/audio/audio_classifier:audio_classifier",
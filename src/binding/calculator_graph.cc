@@ -1,14 +1,8 @@
-#include "absl/base/const_init.h"
-#include "absl/synchronization/mutex.h"
 #include "binding/calculator_graph.h"
 
 using namespace mediapipe;
 using namespace mediapipe::lua;
 
-// A mutex to guard the output stream observer lua callback function.
-// Only one lua callback can run at once.
-static absl::Mutex callback_mutex(absl::kConstInit);
-
 namespace mediapipe::lua::calculator_graph {
 	absl::StatusOr<std::shared_ptr<CalculatorGraph>> create(CalculatorGraphConfig& graph_config) {
 		auto calculator_graph = std::make_shared<CalculatorGraph>();
@@ -66,10 +60,12 @@ namespace mediapipe::lua::calculator_graph {
 		PacketCallback callback_fn,
 		bool observe_timestamp_bounds
 	) {
+		// The graph calls the observer of a stream for one packet at a time,
+		// and lua callbacks called from a graph thread are queued to the lua thread:
+		// there is nothing to guard here, graphs and streams never wait for each other.
 		return self->ObserveOutputStream(
 			stream_name,
 			std::move([callback_fn, stream_name](const Packet& packet) {
-				absl::MutexLock lock(&callback_mutex);
 				callback_fn(stream_name, packet);
 				return absl::OkStatus();
 			}),
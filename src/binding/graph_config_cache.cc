@@ -0,0 +1,264 @@
+#include "absl/strings/numbers.h"
+#include "absl/synchronization/mutex.h"
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl_lite.h"
+#include "binding/graph_config_cache.h"
+#include "binding/util.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+	using namespace mediapipe::lua::graph_config_cache;
+
+	constexpr char kMagic[] = "MPLUAGC2";
+	// Entries written by another version of the bindings or of mediapipe are not reused
+	constexpr char kVersion[] = LUA_MODULE_QUOTE_STRING(LUA_MODULE_VERSION) "/" LUA_MODULE_QUOTE_STRING(LUA_MODULE_LIB_VERSION);
+
+	absl::Mutex cache_mutex;
+	std::string cache_dir;
+	std::unordered_map<std::string, std::shared_ptr<const CachedGraphConfig>> cache;
+
+	// FNV-1a, stable across processes, unlike std::hash
+	uint64_t Fingerprint(const std::string& key) {
+		uint64_t hash = 14695981039346656037ULL;
+		for (const auto c : key) {
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	std::string GetVersionedKey(const std::string& key) {
+		return std::string(kVersion) + "\n" + key;
+	}
+
+	std::filesystem::path GetCachePath(const std::string& dir, const std::string& versioned_key) {
+		char name[32];
+		std::snprintf(name, sizeof(name), "%016llx.graphcache", static_cast<unsigned long long>(Fingerprint(versioned_key)));
+		return std::filesystem::path(dir) / name;
+	}
+
+	void WriteString(std::ostream& out, const std::string& str) {
+		const uint64_t length = str.size();
+		out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+		out.write(str.data(), str.size());
+	}
+
+	// Reads the fields of a cache file, a truncated or corrupted file is a miss
+	struct Reader {
+		const std::string& data;
+		size_t position = 0;
+
+		bool ReadString(std::string& str) {
+			uint64_t length;
+			if (data.size() - position < sizeof(length)) {
+				return false;
+			}
+			std::memcpy(&length, data.data() + position, sizeof(length));
+			position += sizeof(length);
+
+			if (length > data.size() - position) {
+				return false;
+			}
+			str.assign(data, position, length);
+			position += length;
+			return true;
+		}
+
+		bool ReadTypes(std::map<std::string, int>& types) {
+			std::string count_str;
+			size_t count;
+			if (!ReadString(count_str) || !absl::SimpleAtoi(count_str, &count)) {
+				return false;
+			}
+
+			std::string name;
+			std::string type_str;
+			int type;
+			for (; count > 0; count--) {
+				if (!ReadString(name) || !ReadString(type_str) || !absl::SimpleAtoi(type_str, &type)) {
+					return false;
+				}
+				types[name] = type;
+			}
+
+			return true;
+		}
+	};
+
+	void WriteTypes(std::ostream& out, const std::map<std::string, int>& types) {
+		WriteString(out, std::to_string(types.size()));
+		for (const auto& [name, type] : types) {
+			WriteString(out, name);
+			WriteString(out, std::to_string(type));
+		}
+	}
+
+	std::shared_ptr<const CachedGraphConfig> Load(const std::string& dir, const std::string& key) {
+		const auto versioned_key = GetVersionedKey(key);
+
+		std::ifstream in(GetCachePath(dir, versioned_key), std::ios::binary);
+		if (!in) {
+			return nullptr;
+		}
+
+		std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		if (in.bad()) {
+			return nullptr;
+		}
+
+		Reader reader{ data };
+		std::string magic;
+		std::string stored_key;
+		std::string config;
+		auto entry = std::make_shared<CachedGraphConfig>();
+
+		// The stored key guards against fingerprint collisions and stale files
+		if (!reader.ReadString(magic) || magic != kMagic
+			|| !reader.ReadString(stored_key) || stored_key != versioned_key
+			|| !reader.ReadString(config) || !entry->config.ParseFromString(config)
+			|| !reader.ReadTypes(entry->input_stream_types)
+			|| !reader.ReadTypes(entry->output_stream_types)
+			|| !reader.ReadTypes(entry->side_input_types)) {
+			return nullptr;
+		}
+
+		return entry;
+	}
+
+	// Unique per writer, so that concurrent writers, in this process or in others, never share a temporary file
+	std::string GetTemporarySuffix() {
+		static const auto nonce = std::random_device()();
+		static std::atomic<uint64_t> counter = 0;
+
+#ifdef _WIN32
+		const auto pid = _getpid();
+#else
+		const auto pid = getpid();
+#endif
+
+		return "." + std::to_string(pid) + "-" + std::to_string(nonce) + "-" + std::to_string(counter++) + ".tmp";
+	}
+
+	void Store(const std::string& dir, const std::string& key, const CachedGraphConfig& entry) {
+		namespace fs = std::filesystem;
+
+		std::error_code ec;
+		fs::create_directories(dir, ec);
+
+		const auto versioned_key = GetVersionedKey(key);
+		const auto path = GetCachePath(dir, versioned_key);
+		auto tmp_path = path;
+		tmp_path += GetTemporarySuffix();
+
+		{
+			std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+			if (!out) {
+				return;
+			}
+
+			WriteString(out, kMagic);
+			WriteString(out, versioned_key);
+			WriteString(out, SerializeDeterministic(entry.config));
+			WriteTypes(out, entry.input_stream_types);
+			WriteTypes(out, entry.output_stream_types);
+			WriteTypes(out, entry.side_input_types);
+
+			if (!out) {
+				out.close();
+				fs::remove(tmp_path, ec);
+				return;
+			}
+		}
+
+		// Concurrent writers of the same entry write the same content, the last rename wins
+		fs::rename(tmp_path, path, ec);
+		if (ec) {
+			fs::remove(tmp_path, ec);
+		}
+	}
+}
+
+namespace mediapipe::lua::graph_config_cache {
+	std::string SerializeDeterministic(const CalculatorGraphConfig& graph_config) {
+		std::string serialized;
+		{
+			google::protobuf::io::StringOutputStream stream(&serialized);
+			google::protobuf::io::CodedOutputStream output(&stream);
+			output.SetSerializationDeterministic(true);
+			graph_config.SerializeToCodedStream(&output);
+		}
+		return serialized;
+	}
+
+	std::shared_ptr<const CachedGraphConfig> Lookup(const std::string& key) {
+		std::string dir;
+
+		{
+			absl::MutexLock lock(&cache_mutex);
+			auto found = cache.find(key);
+			if (found != cache.end()) {
+				return found->second;
+			}
+			dir = cache_dir;
+		}
+
+		if (dir.empty()) {
+			return nullptr;
+		}
+
+		auto entry = Load(dir, key);
+		if (entry) {
+			absl::MutexLock lock(&cache_mutex);
+			cache.emplace(key, entry);
+		}
+
+		return entry;
+	}
+
+	void Insert(const std::string& key, std::shared_ptr<const CachedGraphConfig> entry) {
+		std::string dir;
+
+		{
+			absl::MutexLock lock(&cache_mutex);
+			cache[key] = entry;
+			dir = cache_dir;
+		}
+
+		if (!dir.empty()) {
+			Store(dir, key, *entry);
+		}
+	}
+
+	void set_cache_dir(const std::string& dir) {
+		absl::MutexLock lock(&cache_mutex);
+		cache_dir = dir;
+	}
+
+	const std::string get_cache_dir() {
+		absl::MutexLock lock(&cache_mutex);
+		return cache_dir;
+	}
+
+	void clear() {
+		absl::MutexLock lock(&cache_mutex);
+		cache.clear();
+	}
+
+	size_t size() {
+		absl::MutexLock lock(&cache_mutex);
+		return cache.size();
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "mediapipe/framework/calculator.pb.h"
+#include <map>
+#include <memory>
+#include <opencv2/core/cvdef.h>
+#include <string>
+
+namespace mediapipe::lua::graph_config_cache {
+	// A canonicalized, subgraph-expanded graph config and the packet data types of its interface.
+	// Types are the integer values of solution_base::PacketDataType.
+	struct CachedGraphConfig {
+		CalculatorGraphConfig config;
+		std::map<std::string, int> input_stream_types;
+		std::map<std::string, int> output_stream_types;
+		std::map<std::string, int> side_input_types;
+	};
+
+	// Serializes graph_config deterministically, so that equal configs give equal keys.
+	std::string SerializeDeterministic(const CalculatorGraphConfig& graph_config);
+
+	// Looks key up in memory, then in the cache directory if there is one.
+	std::shared_ptr<const CachedGraphConfig> Lookup(const std::string& key);
+
+	// Stores entry in memory, and in the cache directory if there is one.
+	void Insert(const std::string& key, std::shared_ptr<const CachedGraphConfig> entry);
+
+	/**
+	 * Sets the directory where expanded graph configs are persisted across processes.
+	 * An empty directory keeps the cache in memory only, which is the default.
+	 */
+	CV_EXPORTS_W void set_cache_dir(const std::string& cache_dir);
+	CV_EXPORTS_W const std::string get_cache_dir();
+
+	/**
+	 * Forgets the in memory entries. Persisted entries are kept.
+	 */
+	CV_EXPORTS_W void clear();
+	CV_EXPORTS_W size_t size();
+}
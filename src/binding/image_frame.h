@@ -42,25 +42,38 @@ namespace mediapipe::lua {
 			MP_ASSERT_RETURN_IF_ERROR(false, "Unsupported MediaPipe image format");
 		}
 
+		MP_ASSERT_RETURN_IF_ERROR(data.dims <= 2, "image data is expected to have at most 2 dimensions");
+
 		int width = data.cols;
 		int height = data.rows;
 		int width_step = data.step;
 
-		auto image_frame = std::make_unique<ImageFrame>(
-			format, width, height, width_step,
-			const_cast<uint8_t*>(data.ptr()),
-			ImageFrame::PixelDataDeleter::kNone
-		);
+		// CPU calculators access the pixels channel by channel,
+		// data can only be borrowed if rows and channels are aligned on the channel size.
+		const auto channel_size = data.elemSize1();
+		const bool borrowable = width_step % channel_size == 0 && reinterpret_cast<uintptr_t>(data.ptr()) % channel_size == 0;
+
+		if (copy || !borrowable) {
+			const ImageFrame image_frame(
+				format, width, height, width_step,
+				const_cast<uint8_t*>(data.ptr()),
+				ImageFrame::PixelDataDeleter::kNone
+			);
 
-		if (copy) {
 			auto image_frame_copy = std::make_unique<ImageFrame>();
 			// Set alignment_boundary to kGlDefaultAlignmentBoundary so that both
 			// GPU and CPU can process it.
-			image_frame_copy->CopyFrom(*image_frame, ImageFrame::kGlDefaultAlignmentBoundary);
+			image_frame_copy->CopyFrom(image_frame, ImageFrame::kGlDefaultAlignmentBoundary);
 			return image_frame_copy;
 		}
 
-		return image_frame;
+		// The deleter holds a reference on the matrix,
+		// keeping the pixels alive for as long as the ImageFrame needs them.
+		return std::make_unique<ImageFrame>(
+			format, width, height, width_step,
+			const_cast<uint8_t*>(data.ptr()),
+			[data](uint8_t*) {}
+		);
 	}
 
 	[[nodiscard]] inline absl::StatusOr<std::unique_ptr<ImageFrame>> CreateImageFrame(const cv::Mat& data, bool copy = true) {
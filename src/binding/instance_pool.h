@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
+
+namespace mediapipe::lua::instance_pool {
+	enum class DispatchPolicy {
+		ROUND_ROBIN,
+		LEAST_LOADED,
+	};
+
+	static const char* DispatchPolicyToChar[] =
+	{
+		"ROUND_ROBIN",
+		"LEAST_LOADED",
+	};
+
+	// Number of instances of the batch calls given 0 workers
+	constexpr int kDefaultNumWorkers = 4;
+
+	inline int GetDefaultNumWorkers() {
+		return std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, kDefaultNumWorkers);
+	}
+
+	// Runs requests on a set of independent instances, one native worker thread per instance.
+	// Requests are numbered in submission order and their responses are delivered in that same order,
+	// whatever the instance that processed them.
+	//
+	// Dispatch, Enqueue and Poll are meant to be called from the lua thread,
+	// the processor is called from the worker threads and must not touch the lua state.
+	template<typename Instance, typename Request, typename Response>
+	class InstancePool {
+	public:
+		using Processor = std::function<absl::StatusOr<Response>(Instance&, Request&&)>;
+
+		InstancePool(
+			std::vector<std::shared_ptr<Instance>> instances,
+			Processor processor,
+			DispatchPolicy dispatch_policy
+		) : m_processor(std::move(processor)), m_dispatch_policy(dispatch_policy) {
+			m_workers.reserve(instances.size());
+			for (auto& instance : instances) {
+				m_workers.push_back(std::make_unique<Worker>());
+				m_workers.back()->instance = std::move(instance);
+			}
+
+			for (auto& worker : m_workers) {
+				worker->thread = std::thread(&InstancePool::Run, this, worker.get());
+			}
+		}
+
+		~InstancePool() {
+			{
+				absl::MutexLock lock(&m_mutex);
+				m_stopping = true;
+				for (auto& worker : m_workers) {
+					worker->cond.SignalAll();
+				}
+			}
+
+			for (auto& worker : m_workers) {
+				worker->thread.join();
+			}
+		}
+
+		size_t size() const {
+			return m_workers.size();
+		}
+
+		Instance& at(size_t index) const {
+			return *m_workers[index]->instance;
+		}
+
+		// Returns the index of the instance the next request should go to
+		size_t Dispatch() {
+			if (m_dispatch_policy == DispatchPolicy::ROUND_ROBIN) {
+				auto index = m_next_worker;
+				m_next_worker = (m_next_worker + 1) % m_workers.size();
+				return index;
+			}
+
+			absl::MutexLock lock(&m_mutex);
+			size_t index = 0;
+			for (size_t i = 1; i < m_workers.size(); i++) {
+				if (m_workers[i]->load < m_workers[index]->load) {
+					index = i;
+				}
+			}
+			return index;
+		}
+
+		// Queues a request on the instance at index and returns its request id
+		int64_t Enqueue(size_t index, Request&& request) {
+			absl::MutexLock lock(&m_mutex);
+			auto& worker = *m_workers[index];
+			const auto request_id = m_next_request_id++;
+			worker.queue.emplace_back(request_id, std::move(request));
+			worker.load++;
+			worker.cond.Signal();
+			return request_id;
+		}
+
+		// Number of requests whose response has not been polled yet
+		int64_t pending() const {
+			return m_next_request_id - m_next_delivery_id;
+		}
+
+		// Takes the response of the oldest request.
+		// Returns false if there is no pending request, or if block is false and the response is not ready yet.
+		bool Poll(int64_t& request_id, absl::StatusOr<Response>& response, bool block) {
+			absl::MutexLock lock(&m_mutex);
+
+			if (m_next_delivery_id == m_next_request_id) {
+				return false;
+			}
+
+			while (m_completed.empty() || m_completed.begin()->first != m_next_delivery_id) {
+				if (!block) {
+					return false;
+				}
+				m_completed_cond.Wait(&m_mutex);
+			}
+
+			auto found = m_completed.begin();
+			request_id = found->first;
+			response = std::move(found->second);
+			m_completed.erase(found);
+			m_next_delivery_id++;
+			return true;
+		}
+
+		// Processes requests on the instances and returns their responses in request order,
+		// or the first error once every request has been processed.
+		// Requests enqueued before and not polled yet are processed but their responses are dropped.
+		absl::StatusOr<std::vector<Response>> ProcessAll(std::vector<Request>&& requests) {
+			if (requests.empty()) {
+				return std::vector<Response>();
+			}
+
+			const auto first_request_id = Enqueue(Dispatch(), std::move(requests[0]));
+			for (size_t i = 1; i < requests.size(); i++) {
+				Enqueue(Dispatch(), std::move(requests[i]));
+			}
+
+			std::vector<Response> responses;
+			responses.reserve(requests.size());
+			absl::Status status;
+
+			// wait for every request, even after a failure, so that the pool is left without pending requests
+			int64_t request_id;
+			absl::StatusOr<Response> response;
+			while (Poll(request_id, response, true)) {
+				if (request_id < first_request_id || !status.ok()) {
+					continue;
+				}
+
+				if (!response.ok()) {
+					status = response.status();
+					continue;
+				}
+
+				responses.push_back(std::move(*response));
+			}
+
+			if (!status.ok()) {
+				return status;
+			}
+			return responses;
+		}
+
+	private:
+		struct Worker {
+			std::shared_ptr<Instance> instance;
+			std::deque<std::pair<int64_t, Request>> queue;
+			// queued and running requests
+			size_t load = 0;
+			absl::CondVar cond;
+			std::thread thread;
+		};
+
+		void Run(Worker* worker) {
+			while (true) {
+				std::pair<int64_t, Request> job;
+
+				{
+					absl::MutexLock lock(&m_mutex);
+					while (!m_stopping && worker->queue.empty()) {
+						worker->cond.Wait(&m_mutex);
+					}
+
+					if (m_stopping) {
+						return;
+					}
+
+					job = std::move(worker->queue.front());
+					worker->queue.pop_front();
+				}
+
+				auto response = m_processor(*worker->instance, std::move(job.second));
+
+				absl::MutexLock lock(&m_mutex);
+				worker->load--;
+				m_completed.emplace(job.first, std::move(response));
+				m_completed_cond.SignalAll();
+			}
+		}
+
+		Processor m_processor;
+		DispatchPolicy m_dispatch_policy;
+		std::vector<std::unique_ptr<Worker>> m_workers;
+		size_t m_next_worker = 0;
+
+		absl::Mutex m_mutex;
+		absl::CondVar m_completed_cond;
+		bool m_stopping = false;
+		int64_t m_next_request_id = 0;
+		int64_t m_next_delivery_id = 0;
+		std::map<int64_t, absl::StatusOr<Response>> m_completed;
+	};
+}
@@ -0,0 +1,270 @@
+#include "absl/synchronization/mutex.h"
+#include "google/protobuf/any.pb.h"
+#include "google/protobuf/descriptor.h"
+#include "google/protobuf/dynamic_message.h"
+#include "mediapipe/tasks/cc/core/proto/external_file.pb.h"
+#include "mediapipe/util/resource_util.h"
+#include "binding/model_asset_registry.h"
+#include "binding/util.h"
+#include <filesystem>
+#include <map>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace {
+	using namespace mediapipe::lua::model_asset_registry;
+	using mediapipe::tasks::core::proto::ExternalFile;
+
+	struct Entry {
+		fs::file_time_type mtime;
+		uintmax_t size;
+		// the users of the file own the mapping, the registry only finds it
+		std::weak_ptr<const ModelAsset> asset;
+	};
+
+	absl::Mutex registry_mutex;
+	std::map<std::string, Entry> registry;
+
+	bool IsModelFile(const std::string& path) {
+		return fs::path(path).extension() == ".tflite";
+	}
+
+	// registry_mutex must be held
+	void PruneExpired() {
+		for (auto it = registry.begin(); it != registry.end();) {
+			if (it->second.asset.expired()) {
+				it = registry.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
+	absl::StatusOr<std::shared_ptr<const ModelAsset>> Map(const std::string& path, size_t size) {
+		if (size == 0) {
+			// mmap does not accept empty mappings
+			static const char empty = 0;
+			return std::make_shared<const ModelAsset>(path, &empty, 0, nullptr);
+		}
+
+#ifdef _WIN32
+		std::wstring wpath = fs::path(path).wstring();
+		HANDLE file = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		MP_ASSERT_RETURN_IF_ERROR(file != INVALID_HANDLE_VALUE, "Cannot open " << path);
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		MP_ASSERT_RETURN_IF_ERROR(mapping != nullptr, "Cannot map " << path);
+
+		const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+		if (data == nullptr) {
+			CloseHandle(mapping);
+		}
+		MP_ASSERT_RETURN_IF_ERROR(data != nullptr, "Cannot map " << path);
+
+		return std::make_shared<const ModelAsset>(path, data, size, mapping);
+#else
+		int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		MP_ASSERT_RETURN_IF_ERROR(fd >= 0, "Cannot open " << path);
+
+		void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		MP_ASSERT_RETURN_IF_ERROR(data != MAP_FAILED, "Cannot map " << path);
+
+		return std::make_shared<const ModelAsset>(path, data, size, nullptr);
+#endif
+	}
+
+	// Returns whether message was changed
+	absl::StatusOr<bool> MapExternalFilesImpl(google::protobuf::Message& message, std::vector<std::shared_ptr<const ModelAsset>>& assets) {
+		using google::protobuf::FieldDescriptor;
+
+		const auto* descriptor = message.GetDescriptor();
+
+		if (descriptor == ExternalFile::descriptor()) {
+			auto& external_file = static_cast<ExternalFile&>(message);
+			if (external_file.file_name().empty() || !external_file.file_content().empty()
+				|| external_file.has_file_descriptor_meta() || external_file.has_file_pointer_meta()) {
+				return false;
+			}
+
+			// the pointer is only written in a message whose user holds the mapping
+			MP_ASSIGN_OR_RETURN(auto asset, Acquire(external_file.file_name()));
+			auto* file_pointer_meta = external_file.mutable_file_pointer_meta();
+			file_pointer_meta->set_pointer(reinterpret_cast<uintptr_t>(asset->data()));
+			file_pointer_meta->set_length(asset->size());
+			assets.push_back(std::move(asset));
+			return true;
+		}
+
+		const auto* reflection = message.GetReflection();
+
+		if (descriptor->full_name() == google::protobuf::Any::descriptor()->full_name()) {
+			const auto* type_url_field = descriptor->FindFieldByNumber(1);
+			const auto* value_field = descriptor->FindFieldByNumber(2);
+
+			std::string type_url = reflection->GetString(message, type_url_field);
+			const auto* type = google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(
+				type_url.substr(type_url.find_last_of('/') + 1));
+			if (type == nullptr) {
+				return false;
+			}
+
+			const auto* prototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(type);
+			std::unique_ptr<google::protobuf::Message> value(prototype->New());
+			if (!value->ParseFromString(reflection->GetString(message, value_field))) {
+				return false;
+			}
+
+			MP_ASSIGN_OR_RETURN(auto changed, MapExternalFilesImpl(*value, assets));
+			if (changed) {
+				reflection->SetString(&message, value_field, value->SerializeAsString());
+			}
+			return changed;
+		}
+
+		std::vector<const FieldDescriptor*> fields;
+		reflection->ListFields(message, &fields);
+
+		bool changed = false;
+		for (const auto* field : fields) {
+			if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+				continue;
+			}
+
+			if (field->is_repeated()) {
+				for (int i = 0; i < reflection->FieldSize(message, field); i++) {
+					MP_ASSIGN_OR_RETURN(auto field_changed, MapExternalFilesImpl(*reflection->MutableRepeatedMessage(&message, field, i), assets));
+					changed = changed || field_changed;
+				}
+			}
+			else {
+				MP_ASSIGN_OR_RETURN(auto field_changed, MapExternalFilesImpl(*reflection->MutableMessage(&message, field), assets));
+				changed = changed || field_changed;
+			}
+		}
+
+		return changed;
+	}
+
+	class MappedResources : public mediapipe::Resources {
+	public:
+		explicit MappedResources(std::unique_ptr<mediapipe::Resources> fallback) : m_fallback(std::move(fallback)) {}
+
+		using mediapipe::Resources::Get;
+
+		absl::StatusOr<std::unique_ptr<mediapipe::Resource>> Get(absl::string_view resource_id, const Options& options) const override {
+			auto path = mediapipe::PathToResourceAsFile(std::string(resource_id));
+			if (path.ok() && IsModelFile(*path) && fs::is_regular_file(*path)) {
+				auto asset = Acquire(*path);
+				if (asset.ok()) {
+					const auto& mapping = *asset;
+					return mediapipe::MakeCleanupResource(mapping->data(), mapping->size(), [mapping]() {});
+				}
+			}
+			return m_fallback->Get(resource_id, options);
+		}
+
+	private:
+		std::unique_ptr<mediapipe::Resources> m_fallback;
+	};
+}
+
+namespace mediapipe::lua::model_asset_registry {
+	ModelAsset::~ModelAsset() {
+		if (m_size == 0) {
+			return;
+		}
+
+#ifdef _WIN32
+		UnmapViewOfFile(m_data);
+		CloseHandle(static_cast<HANDLE>(m_handle));
+#else
+		munmap(const_cast<void*>(m_data), m_size);
+#endif
+	}
+
+	absl::StatusOr<std::shared_ptr<const ModelAsset>> Acquire(const std::string& path) {
+		std::error_code ec;
+
+		const auto canonical_path = fs::canonical(path, ec).string();
+		MP_ASSERT_RETURN_IF_ERROR(!ec, "Cannot resolve " << path << ": " << ec.message());
+
+		const auto mtime = fs::last_write_time(canonical_path, ec);
+		MP_ASSERT_RETURN_IF_ERROR(!ec, "Cannot stat " << canonical_path << ": " << ec.message());
+
+		const auto size = fs::file_size(canonical_path, ec);
+		MP_ASSERT_RETURN_IF_ERROR(!ec, "Cannot stat " << canonical_path << ": " << ec.message());
+
+		{
+			absl::MutexLock lock(&registry_mutex);
+			auto found = registry.find(canonical_path);
+			if (found != registry.end() && found->second.mtime == mtime && found->second.size == size) {
+				if (auto asset = found->second.asset.lock()) {
+					return asset;
+				}
+			}
+		}
+
+		// map outside of the lock, concurrent acquirers of the same new file keep the first mapping registered
+		MP_ASSIGN_OR_RETURN(auto asset, Map(canonical_path, size));
+
+		// unmapped outside of the lock when another acquirer registered the file first
+		std::shared_ptr<const ModelAsset> stale;
+
+		{
+			absl::MutexLock lock(&registry_mutex);
+			auto& entry = registry[canonical_path];
+			auto registered = entry.asset.lock();
+			if (registered && entry.mtime == mtime && entry.size == size) {
+				stale = std::move(asset);
+				asset = std::move(registered);
+			}
+			else {
+				entry = Entry{ mtime, size, asset };
+			}
+			PruneExpired();
+		}
+
+		return asset;
+	}
+
+	absl::StatusOr<std::shared_ptr<const ModelAsset>> MapFile(const std::string& path) {
+		std::error_code ec;
+
+		const auto size = fs::file_size(path, ec);
+		MP_ASSERT_RETURN_IF_ERROR(!ec, "Cannot stat " << path << ": " << ec.message());
+
+		return Map(path, size);
+	}
+
+	absl::Status MapExternalFiles(google::protobuf::Message& message, std::vector<std::shared_ptr<const ModelAsset>>& assets) {
+		return MapExternalFilesImpl(message, assets).status();
+	}
+
+	std::shared_ptr<Resources> CreateResources(std::unique_ptr<Resources> fallback) {
+		return std::make_shared<MappedResources>(std::move(fallback));
+	}
+
+	void clear() {
+		absl::MutexLock lock(&registry_mutex);
+		registry.clear();
+	}
+
+	size_t size() {
+		absl::MutexLock lock(&registry_mutex);
+		PruneExpired();
+		return registry.size();
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "absl/status/statusor.h"
+#include "google/protobuf/message.h"
+#include "mediapipe/framework/resources.h"
+#include <cstdint>
+#include <memory>
+#include <opencv2/core/cvdef.h>
+#include <string>
+#include <vector>
+
+namespace mediapipe::lua::model_asset_registry {
+	// A model file mapped read-only in memory. The mapping is released with the last reference.
+	class ModelAsset {
+	public:
+		ModelAsset(const std::string& path, const void* data, size_t size, void* handle)
+			: m_path(path), m_data(data), m_size(size), m_handle(handle) {}
+		~ModelAsset();
+
+		ModelAsset(const ModelAsset&) = delete;
+		ModelAsset& operator=(const ModelAsset&) = delete;
+
+		const std::string& path() const {
+			return m_path;
+		}
+
+		const void* data() const {
+			return m_data;
+		}
+
+		size_t size() const {
+			return m_size;
+		}
+
+	private:
+		std::string m_path;
+		const void* m_data;
+		size_t m_size;
+		void* m_handle;
+	};
+
+	// Returns the mapping of the file at path, shared with every other user of the same file.
+	// Files are identified by their canonical path, modification time and size,
+	// a file modified on disk gets a new mapping.
+	// The registry does not own the mappings, a file is unmapped when its last user releases it.
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<const ModelAsset>> Acquire(const std::string& path);
+
+	// Maps the file at path on its own, without registering it, for files read once such as recordings.
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<const ModelAsset>> MapFile(const std::string& path);
+
+	// Points the ExternalFile messages of message that only name a file, including the ones packed in Any fields,
+	// to the registry mapping of that file, and appends the mappings to assets.
+	// The caller must keep assets as long as message, or a copy of it, is in use.
+	[[nodiscard]] absl::Status MapExternalFiles(google::protobuf::Message& message, std::vector<std::shared_ptr<const ModelAsset>>& assets);
+
+	// Resources that serve the model files (.tflite) from their registry mapping, and the other resources from fallback.
+	std::shared_ptr<Resources> CreateResources(std::unique_ptr<Resources> fallback);
+
+	/**
+	 * Forgets the registered mappings.
+	 * Mappings still used by a task or a solution stay mapped until they are closed.
+	 */
+	CV_EXPORTS_W void clear();
+	// Number of mapped files still in use
+	CV_EXPORTS_W size_t size();
+}
@@ -1,4 +1,5 @@
 #include "binding/packet_creator.h"
+#include <cstring>
 
 namespace {
 	using namespace mediapipe::lua;
@@ -113,7 +114,12 @@ namespace mediapipe::lua::packet_creator {
 
 	std::shared_ptr<Packet> create_image(const Image& image, ImageFormat::Format image_format, bool copy) {
 		LUA_MODULE_ASSERT_THROW(image.image_format() == image_format, "The provided image_format doesn't match the one from the data arg.");
-		LUA_MODULE_ASSERT_THROW(copy, "Creating Image packet by taking a reference of another Image object is not supported yet.");
+
+		if (!copy) {
+			// Image copies share the underlying ImageFrame, which the packet keeps alive
+			const auto& packet = MakePacket<Image>(image);
+			return std::make_shared<Packet>(std::move(packet));
+		}
 
 		auto image_frame = absl::make_unique<ImageFrame>();
 		// Set alignment_boundary to kGlDefaultAlignmentBoundary so that
@@ -139,48 +145,69 @@ namespace mediapipe::lua::packet_creator {
 	}
 
 	std::shared_ptr<Packet> create_matrix(const cv::Mat& data, bool transpose) {
+		return create_matrix_from_blocks(std::vector<cv::Mat>{ data }, transpose);
+	}
+
+	std::shared_ptr<Packet> create_matrix_from_blocks(const std::vector<cv::Mat>& blocks, bool transpose) {
 		using _Tp = float;
 
-		LUA_MODULE_ASSERT_THROW(data.type() == cv::traits::Type<_Tp>::value, "The data should be a float matrix");
-		LUA_MODULE_ASSERT_THROW(data.dims <= 2, "The data is expected to have at most 2 dimensions");
-		LUA_MODULE_ASSERT_THROW(data.cols == 1 || data.channels() == 1, "The data is expected be a 2d matrix");
+		LUA_MODULE_ASSERT_THROW(!blocks.empty(), "The data should have at least one block");
 
-		const auto& rows = data.rows;
-		const auto& cols = data.cols * data.channels();
+		const auto cols = blocks[0].cols * blocks[0].channels();
+		int rows = 0;
+
+		for (const auto& data : blocks) {
+			LUA_MODULE_ASSERT_THROW(data.depth() == cv::traits::Type<_Tp>::value, "The data should be a float matrix");
+			LUA_MODULE_ASSERT_THROW(data.dims <= 2, "The data is expected to have at most 2 dimensions");
+			LUA_MODULE_ASSERT_THROW(data.cols == 1 || data.channels() == 1, "The data is expected be a 2d matrix");
+			LUA_MODULE_ASSERT_THROW(data.empty() || data.cols * data.channels() == cols, "The blocks are expected to have the same number of columns");
+			rows += data.rows;
+		}
 
 		std::unique_ptr<Matrix> matrix_ptr = std::make_unique<Matrix>();
 		auto& matrix = *matrix_ptr;
 
 		if (transpose) {
 			matrix.resize(cols, rows);
-			if (!(matrix.Flags & Eigen::RowMajorBit)) {
-				const cv::Mat _dst(matrix.cols(), matrix.rows(), cv::traits::Type<_Tp>::value,
-					reinterpret_cast<void*>(matrix.data()), (size_t)(matrix.outerStride() * sizeof(_Tp)));
-				data.reshape(1).convertTo(_dst, _dst.type());
-			}
-			else {
-				const cv::Mat _dst(matrix.rows(), matrix.cols(), cv::traits::Type<_Tp>::value,
-					reinterpret_cast<void*>(matrix.data()), (size_t)(matrix.outerStride() * sizeof(_Tp)));
-				cv::transpose(data.reshape(1), _dst);
-			}
 		}
 		else {
 			matrix.resize(rows, cols);
-			if (!(matrix.Flags & Eigen::RowMajorBit)) {
-				const cv::Mat _dst(matrix.cols(), matrix.rows(), cv::traits::Type<_Tp>::value,
-					reinterpret_cast<void*>(matrix.data()), (size_t)(matrix.outerStride() * sizeof(_Tp)));
-				cv::transpose(data.reshape(1), _dst);
+		}
+
+		// rows x cols view of the data when the storage order of the matrix matches its transposition, cols x rows otherwise
+		const bool same_layout = transpose != static_cast<bool>(matrix.Flags & Eigen::RowMajorBit);
+		const cv::Mat _dst(same_layout ? rows : cols, same_layout ? cols : rows, cv::traits::Type<_Tp>::value,
+			reinterpret_cast<void*>(matrix.data()), (size_t)(matrix.outerStride() * sizeof(_Tp)));
+
+		int offset = 0;
+		for (const auto& data : blocks) {
+			if (data.empty()) {
+				continue;
+			}
+
+			if (same_layout && data.isContinuous()) {
+				// the block is laid out like the matrix storage, such as interleaved audio samples in a channel-major matrix
+				std::memcpy(_dst.data + offset * _dst.step[0], data.data, data.total() * data.elemSize());
+			}
+			else if (same_layout) {
+				cv::Mat dst = _dst.rowRange(offset, offset + data.rows);
+				data.reshape(1).copyTo(dst);
 			}
 			else {
-				const cv::Mat _dst(matrix.rows(), matrix.cols(), cv::traits::Type<_Tp>::value,
-					reinterpret_cast<void*>(matrix.data()), (size_t)(matrix.outerStride() * sizeof(_Tp)));
-				data.reshape(1).convertTo(_dst, _dst.type());
+				cv::Mat dst = _dst.colRange(offset, offset + data.rows);
+				cv::transpose(data.reshape(1), dst);
 			}
+
+			offset += data.rows;
 		}
 
 		return std::make_shared<Packet>(std::move(Adopt<Matrix>(matrix_ptr.release())));
 	}
 
+	std::shared_ptr<Packet> create_matrix(Matrix&& matrix) {
+		return std::make_shared<Packet>(std::move(Adopt<Matrix>(new Matrix(std::move(matrix)))));
+	}
+
 	std::shared_ptr<Packet> create_proto(const google::protobuf::Message& message) {
 		auto type_name = message.GetDescriptor()->full_name();
 
@@ -28,6 +28,10 @@ namespace mediapipe::lua::packet_creator {
 	CV_WRAP std::shared_ptr<Packet> create_image(const cv::Mat& data, bool copy = true);
 	CV_WRAP std::shared_ptr<Packet> create_image(const cv::Mat& data, ImageFormat::Format image_format, bool copy = true);
 	CV_WRAP std::shared_ptr<Packet> create_matrix(const cv::Mat& data, bool transpose = false);
+	// Stacks the rows of blocks straight into the matrix, such as the segments of a ring buffer
+	CV_WRAP std::shared_ptr<Packet> create_matrix_from_blocks(const std::vector<cv::Mat>& blocks, bool transpose = false);
+	// Adopts matrix, its coefficients are moved into the packet without being copied
+	std::shared_ptr<Packet> create_matrix(Matrix&& matrix);
 	CV_WRAP std::shared_ptr<Packet> create_proto(const google::protobuf::Message& message);
 	CV_WRAP std::shared_ptr<Packet> create_image_frame_vector(const std::vector<std::shared_ptr<ImageFrame>>& image_frame_list);
 }
@@ -110,6 +110,26 @@ namespace mediapipe::lua::packet_getter {
 		MP_ASSERT_RETURN_IF_ERROR(false, "Packet doesn't contain std::vector<float> or std::array<float, 4 / 16> containers.");
 	}
 
+	absl::StatusOr<cv::Mat> get_matrix(const Packet& packet) {
+		using _Tp = float;
+
+		MP_PACKET_ASSIGN_OR_RETURN(const auto& matrix, Matrix, packet);
+
+		// a row major view of the storage is the matrix itself, or its transposition for a column major one
+		const bool row_major = static_cast<bool>(Matrix::Flags & Eigen::RowMajorBit);
+		const cv::Mat storage(row_major ? matrix.rows() : matrix.cols(), row_major ? matrix.cols() : matrix.rows(), cv::traits::Type<_Tp>::value,
+			const_cast<_Tp*>(matrix.data()), (size_t)(matrix.outerStride() * sizeof(_Tp)));
+
+		cv::Mat mat;
+		if (row_major) {
+			storage.copyTo(mat);
+		}
+		else {
+			cv::transpose(storage, mat);
+		}
+		return mat;
+	}
+
 	absl::StatusOr<std::shared_ptr<Message>> MessageFromDynamicProto(const std::string& type_name, const std::string& serialized) {
 		using namespace packet_internal;
 
@@ -123,11 +143,16 @@ namespace mediapipe::lua::packet_getter {
 		return std::shared_ptr<Message>(static_cast<Message*>(message_ptr.release()));
 	}
 
+	std::shared_ptr<Message> CopyProto(const MessageLite& message) {
+		const auto& source = static_cast<const Message&>(message);
+		std::shared_ptr<Message> copy(source.New());
+		copy->CopyFrom(source);
+		return copy;
+	}
+
 	absl::StatusOr<std::shared_ptr<Message>> get_proto(const Packet& packet) {
-		const auto& message = packet.GetProtoMessageLite();
-		const std::string& type_name = message.GetTypeName();
-		const std::string& serialized = message.SerializeAsString();
-		return MessageFromDynamicProto(type_name, serialized);
+		// the packet content may still be read by the graph, lua gets its own message
+		return CopyProto(packet.GetProtoMessageLite());
 	}
 
 	absl::Status get_proto_list(const Packet& packet, std::vector<std::shared_ptr<Message>>& proto_list) {
@@ -143,12 +168,9 @@ namespace mediapipe::lua::packet_getter {
 		}
 
 		proto_list.resize(size);
-		auto type_name = proto_vector[0]->GetTypeName();
-
 		int i = 0;
 		for (const MessageLite* proto : proto_vector) {
-			const std::string& serialized = proto->SerializeAsString();
-			MP_ASSIGN_OR_RETURN(proto_list[i++], MessageFromDynamicProto(type_name, serialized));
+			proto_list[i++] = CopyProto(*proto);
 		}
 
 		return absl::OkStatus();
@@ -33,11 +33,18 @@ namespace mediapipe::lua::packet_getter {
 
 	[[nodiscard]] absl::StatusOr<std::shared_ptr<google::protobuf::Message>> MessageFromDynamicProto(const std::string& type_name, const std::string& serialized);
 
+	/**
+	 * Returns a copy of message, without going through its serialized form.
+	 */
+	std::shared_ptr<google::protobuf::Message> CopyProto(const google::protobuf::MessageLite& message);
+
 	CV_WRAP [[nodiscard]] absl::StatusOr<int64_t> get_int(const Packet& packet);
 	CV_WRAP [[nodiscard]] absl::StatusOr<uint64_t> get_uint(const Packet& packet);
 	CV_WRAP [[nodiscard]] absl::StatusOr<float> get_float(const Packet& packet);
 	CV_WRAP [[nodiscard]] absl::StatusOr<std::vector<int64_t>> get_int_list(const Packet& packet);
 	CV_WRAP [[nodiscard]] absl::StatusOr<std::vector<float>> get_float_list(const Packet& packet);
+	// Returns a rows x cols float copy of the matrix of the packet
+	CV_WRAP [[nodiscard]] absl::StatusOr<cv::Mat> get_matrix(const Packet& packet);
 	CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<google::protobuf::Message>> get_proto(const Packet& packet);
 	CV_WRAP [[nodiscard]] absl::Status get_proto_list(const Packet& packet, CV_OUT std::vector<std::shared_ptr<google::protobuf::Message>>& proto_list);
 	CV_WRAP [[nodiscard]] absl::Status get_image_frame_list(const Packet& packet, CV_OUT std::vector<std::shared_ptr<ImageFrame>>& image_frame_list);
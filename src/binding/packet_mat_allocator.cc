@@ -0,0 +1,55 @@
+#include "mediapipe/framework/formats/image_frame_opencv.h"
+#include "binding/packet_mat_allocator.h"
+
+namespace mediapipe::lua {
+	cv::UMatData* PacketMatAllocator::allocate(const Packet& packet, uchar* data, size_t size) const {
+		cv::UMatData* u = new cv::UMatData(this);
+		u->data = u->origdata = data;
+		u->size = size;
+		u->userdata = new Packet(packet);
+		return u;
+	}
+
+	cv::UMatData* PacketMatAllocator::allocate(int dims, const int* sizes, int type, void* data0, size_t* step, cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const {
+		return cv::Mat::getDefaultAllocator()->allocate(dims, sizes, type, data0, step, flags, usageFlags);
+	}
+
+	bool PacketMatAllocator::allocate(cv::UMatData* u, cv::AccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const {
+		return cv::Mat::getDefaultAllocator()->allocate(u, accessFlags, usageFlags);
+	}
+
+	void PacketMatAllocator::deallocate(cv::UMatData* u) const {
+		if (!u) {
+			return;
+		}
+
+		CV_Assert(u->urefcount == 0);
+		CV_Assert(u->refcount == 0);
+
+		if (u->currAllocator != this) {
+			u->currAllocator->deallocate(u);
+			return;
+		}
+
+		delete static_cast<Packet*>(u->userdata);
+		delete u;
+	}
+
+	PacketMatAllocator* PacketMatAllocator::getInstance() {
+		static PacketMatAllocator instance;
+		return &instance;
+	}
+
+	cv::Mat MatViewOfPacket(const ImageFrame& image_frame, const Packet& packet) {
+		cv::Mat mat = formats::MatView(&image_frame);
+		if (mat.empty()) {
+			return mat;
+		}
+
+		auto allocator = PacketMatAllocator::getInstance();
+		mat.u = allocator->allocate(packet, mat.data, mat.step[0] * mat.rows);
+		mat.addref();
+		mat.allocator = allocator;
+		return mat;
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "mediapipe/framework/formats/image_frame.h"
+#include "mediapipe/framework/packet.h"
+#include <opencv2/core/mat.hpp>
+
+namespace mediapipe::lua {
+	// A cv::MatAllocator for matrices aliasing the pixels of an ImageFrame held by a Packet.
+	// The UMatData keeps a reference on the Packet,
+	// so the pixels stay alive as long as a cv::Mat refers to them.
+	// Any new allocation is delegated to the default allocator.
+	class PacketMatAllocator : public cv::MatAllocator {
+	public:
+		cv::UMatData* allocate(const Packet& packet, uchar* data, size_t size) const;
+
+		cv::UMatData* allocate(int dims, const int* sizes, int type, void* data0, size_t* step, cv::AccessFlag flags, cv::UMatUsageFlags usageFlags) const override;
+		bool allocate(cv::UMatData* u, cv::AccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const override;
+		void deallocate(cv::UMatData* u) const override;
+
+		static PacketMatAllocator* getInstance();
+	};
+
+	// Returns a cv::Mat pointing to the pixels of image_frame without copying them.
+	// packet must be the owner of image_frame.
+	cv::Mat MatViewOfPacket(const ImageFrame& image_frame, const Packet& packet);
+}
@@ -0,0 +1,144 @@
+#include "absl/synchronization/mutex.h"
+#include "binding/shared_executor.h"
+#include "binding/util.h"
+#include <deque>
+#include <functional>
+#include <limits>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+	using namespace mediapipe::lua::shared_executor;
+
+#ifdef __linux__
+	constexpr int kMaxCpus = CPU_SETSIZE;
+#else
+	constexpr int kMaxCpus = std::numeric_limits<int>::max();
+#endif
+
+	class ThreadPoolExecutor : public mediapipe::Executor {
+	public:
+		ThreadPoolExecutor(int num_threads, const std::vector<int>& cpu_affinity) : m_state(std::make_shared<State>()) {
+			m_threads.reserve(num_threads);
+			for (int i = 0; i < num_threads; i++) {
+				m_threads.emplace_back(&ThreadPoolExecutor::Run, m_state);
+				SetAffinity(m_threads.back(), cpu_affinity);
+			}
+		}
+
+		~ThreadPoolExecutor() override {
+			{
+				absl::MutexLock lock(&m_state->mutex);
+				m_state->stopping = true;
+				m_state->cond.SignalAll();
+			}
+
+			// The last reference may be released by a task, a thread cannot join itself.
+			// It keeps the state alive and exits once its task and the pending ones are done.
+			const auto this_id = std::this_thread::get_id();
+			for (auto& thread : m_threads) {
+				if (thread.get_id() == this_id) {
+					thread.detach();
+				}
+				else {
+					thread.join();
+				}
+			}
+		}
+
+		void Schedule(std::function<void()> task) override {
+			absl::MutexLock lock(&m_state->mutex);
+			m_state->tasks.push_back(std::move(task));
+			m_state->cond.Signal();
+		}
+
+	private:
+		// Shared with the threads, so that a detached thread does not outlive what it reads
+		struct State {
+			absl::Mutex mutex;
+			absl::CondVar cond;
+			bool stopping = false;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		static void SetAffinity(std::thread& thread, const std::vector<int>& cpu_affinity) {
+#ifdef __linux__
+			if (cpu_affinity.empty()) {
+				return;
+			}
+
+			cpu_set_t cpu_set;
+			CPU_ZERO(&cpu_set);
+			for (const auto cpu : cpu_affinity) {
+				CPU_SET(cpu, &cpu_set);
+			}
+			pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set);
+#endif
+		}
+
+		static void Run(std::shared_ptr<State> state) {
+			while (true) {
+				std::function<void()> task;
+
+				{
+					absl::MutexLock lock(&state->mutex);
+					while (!state->stopping && state->tasks.empty()) {
+						state->cond.Wait(&state->mutex);
+					}
+
+					// Pending tasks still run on destruction, graphs may be waiting for them
+					if (state->tasks.empty()) {
+						return;
+					}
+
+					task = std::move(state->tasks.front());
+					state->tasks.pop_front();
+				}
+
+				task();
+			}
+		}
+
+		std::shared_ptr<State> m_state;
+		std::vector<std::thread> m_threads;
+	};
+
+	absl::Mutex default_mutex;
+	std::shared_ptr<SharedExecutor> default_executor;
+}
+
+namespace mediapipe::lua::shared_executor {
+	absl::StatusOr<std::shared_ptr<SharedExecutor>> SharedExecutor::create(
+		int num_threads,
+		const std::vector<int>& cpu_affinity
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(num_threads >= 1, "num_threads must be greater than 0");
+		for (const auto cpu : cpu_affinity) {
+			MP_ASSERT_RETURN_IF_ERROR(cpu >= 0 && cpu < kMaxCpus, "Invalid CPU id " << cpu);
+		}
+
+		return std::make_shared<SharedExecutor>(std::make_shared<ThreadPoolExecutor>(num_threads, cpu_affinity), num_threads);
+	}
+
+	void SharedExecutor::set_default(std::shared_ptr<SharedExecutor> executor) {
+		absl::MutexLock lock(&default_mutex);
+		default_executor = std::move(executor);
+	}
+
+	std::shared_ptr<SharedExecutor> SharedExecutor::get_default() {
+		absl::MutexLock lock(&default_mutex);
+		return default_executor;
+	}
+
+	std::shared_ptr<mediapipe::Executor> SharedExecutor::GetExecutorOrDefault(const std::shared_ptr<SharedExecutor>& shared_executor) {
+		if (shared_executor) {
+			return shared_executor->get_executor();
+		}
+
+		auto executor = get_default();
+		return executor ? executor->get_executor() : nullptr;
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/executor.h"
+#include <memory>
+#include <opencv2/core/cvdef.h>
+#include <vector>
+
+namespace mediapipe::lua::shared_executor {
+	/**
+	 * A bounded thread pool that several task runners and solution graphs can run on,
+	 * instead of each one starting its own default thread pool.
+	 */
+	class CV_EXPORTS_W SharedExecutor {
+	public:
+		SharedExecutor(std::shared_ptr<mediapipe::Executor> executor, int num_threads)
+			: m_executor(std::move(executor)), m_num_threads(num_threads) {}
+
+		/**
+		 * Creates a pool of num_threads threads.
+		 *
+		 *  Args:
+		 *    num_threads: number of threads of the pool.
+		 *    cpu_affinity: ids of the CPUs the threads are allowed to run on, any CPU if empty.
+		 *                  Only supported on Linux, ignored elsewhere.
+		 */
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<SharedExecutor>> create(
+			int num_threads,
+			const std::vector<int>& cpu_affinity = std::vector<int>()
+		);
+
+		/**
+		 * Sets the executor used by the task runners and solutions created without an explicit executor.
+		 * An empty executor restores the MediaPipe default of one thread pool per graph.
+		 */
+		CV_WRAP static void set_default(std::shared_ptr<SharedExecutor> executor);
+		CV_WRAP static std::shared_ptr<SharedExecutor> get_default();
+
+		CV_WRAP int get_num_threads() const {
+			return m_num_threads;
+		}
+
+		std::shared_ptr<mediapipe::Executor> get_executor() const {
+			return m_executor;
+		}
+
+		// Returns the executor of shared_executor, or of the default shared executor if empty
+		static std::shared_ptr<mediapipe::Executor> GetExecutorOrDefault(const std::shared_ptr<SharedExecutor>& shared_executor);
+
+	private:
+		std::shared_ptr<mediapipe::Executor> m_executor;
+		int m_num_threads;
+	};
+}
@@ -5,7 +5,13 @@
 #include "mediapipe/calculators/util/logic_calculator.pb.h"
 #include "mediapipe/calculators/util/thresholding_calculator.pb.h"
 #include "mediapipe/modules/objectron/calculators/lift_2d_frame_annotation_to_3d_calculator.pb.h"
+#include "mediapipe/framework/resources.h"
+#include "mediapipe/framework/resources_service.h"
+#include "binding/graph_config_cache.h"
+#include "binding/model_asset_registry.h"
+#include "binding/packet_mat_allocator.h"
 #include <lua_bridge.hpp>
+#include <sstream>
 
 #ifdef BOOL
 #undef BOOL
@@ -21,10 +27,6 @@ using namespace google::protobuf::lua::cmessage;
 using namespace google::protobuf;
 using namespace mediapipe::lua::packet_getter;
 
-// A mutex to guard the output stream observer lua callback function.
-// Only one lua callback can run at once.
-static absl::Mutex callback_mutex;
-
 namespace {
 	inline const bool startsWith(const std::string& s, const std::string& prefix) {
 		return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
@@ -536,7 +538,18 @@ namespace {
 		}
 	}
 
-	[[nodiscard]] absl::StatusOr<::LUA_MODULE_NAME::Object> GetPacketContent(PacketDataType packet_data_type, const Packet& output_packet) {
+	/**
+	 * Gets the content of an output packet.
+	 *
+	 * Image outputs alias the content of the packet, which is kept alive by the returned object.
+	 * They are only copied when writable is true. Proto outputs are always copied, lua cannot be prevented from writing them.
+	 *
+	 * @param  packet_data_type [description]
+	 * @param  output_packet    [description]
+	 * @param  writable  [description]
+	 * @return                  [description]
+	 */
+	[[nodiscard]] absl::StatusOr<::LUA_MODULE_NAME::Object> GetPacketContent(PacketDataType packet_data_type, const Packet& output_packet, bool writable) {
 		if (output_packet.IsEmpty()) {
 			return None;
 		}
@@ -582,12 +595,14 @@ namespace {
 		}
 		case PacketDataType::IMAGE: {
 			MP_PACKET_ASSIGN_OR_RETURN(const auto& image, Image, output_packet);
-			result = ::LUA_MODULE_NAME::Object(std::make_shared<cv::Mat>(mediapipe::formats::MatView(image.GetImageFrameSharedPtr().get()).clone()));
+			auto mat = MatViewOfPacket(*image.GetImageFrameSharedPtr(), output_packet);
+			result = ::LUA_MODULE_NAME::Object(std::make_shared<cv::Mat>(writable ? mat.clone() : mat));
 			break;
 		}
 		case PacketDataType::IMAGE_FRAME: {
 			MP_PACKET_ASSIGN_OR_RETURN(const auto& image_frame, ImageFrame, output_packet);
-			result = ::LUA_MODULE_NAME::Object(std::make_shared<cv::Mat>(mediapipe::formats::MatView(&image_frame).clone()));
+			auto mat = MatViewOfPacket(image_frame, output_packet);
+			result = ::LUA_MODULE_NAME::Object(std::make_shared<cv::Mat>(writable ? mat.clone() : mat));
 			break;
 		}
 		case PacketDataType::IMAGE_LIST: {
@@ -596,9 +611,10 @@ namespace {
 			mat_list.resize(image_list.size());
 			int i = 0;
 			for (const auto& image : image_list) {
-				mat_list[i++] = mediapipe::formats::MatView(image.GetImageFrameSharedPtr().get()).clone();
+				auto mat = MatViewOfPacket(*image.GetImageFrameSharedPtr(), output_packet);
+				mat_list[i++] = writable ? mat.clone() : mat;
 			}
-			result = ::LUA_MODULE_NAME::Object(image_list);
+			result = ::LUA_MODULE_NAME::Object(mat_list);
 			break;
 		}
 		case PacketDataType::PROTO:
@@ -617,6 +633,127 @@ namespace {
 		return result;
 	}
 
+	/**
+	 * Creates an input stream packet of a statically known data type.
+	 */
+	template<PacketDataType packet_data_type>
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<Packet>> MakeInputPacket(const ::LUA_MODULE_NAME::Object& data, bool copy) {
+		return ::MakePacket(packet_data_type, data);
+	}
+
+	template<>
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<Packet>> MakeInputPacket<PacketDataType::IMAGE>(const ::LUA_MODULE_NAME::Object& data, bool copy) {
+		{
+			bool is_valid;
+			auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<Image*>(nullptr), is_valid);
+			if (is_valid) {
+				decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<Image*>(nullptr));
+				MP_ASSERT_RETURN_IF_ERROR(value.channels() == 3, "Input image must contain three channel rgb data.");
+				return packet_creator::create_image(value);
+			}
+		}
+
+		{
+			bool is_valid;
+			auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<cv::Mat*>(nullptr), is_valid);
+			if (is_valid) {
+				decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<cv::Mat*>(nullptr));
+				MP_ASSERT_RETURN_IF_ERROR(value.channels() == 3, "Input image must contain three channel rgb data.");
+				MP_ASSIGN_OR_RETURN(auto image_frame, CreateSharedImageFrame(value, copy));
+				return std::make_shared<Packet>(mediapipe::MakePacket<Image>(image_frame));
+			}
+		}
+
+		MP_ASSERT_RETURN_IF_ERROR(false, "data is neither a matrix nor an image");
+	}
+
+	template<>
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<Packet>> MakeInputPacket<PacketDataType::IMAGE_FRAME>(const ::LUA_MODULE_NAME::Object& data, bool copy) {
+		{
+			bool is_valid;
+			auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<ImageFrame*>(nullptr), is_valid);
+			if (is_valid) {
+				decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<ImageFrame*>(nullptr));
+				MP_ASSERT_RETURN_IF_ERROR(value.NumberOfChannels() == 3, "Input image must contain three channel rgb data.");
+				return packet_creator::create_image_frame(value);
+			}
+		}
+
+		{
+			bool is_valid;
+			auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<cv::Mat*>(nullptr), is_valid);
+			if (is_valid) {
+				decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<cv::Mat*>(nullptr));
+				MP_ASSERT_RETURN_IF_ERROR(value.channels() == 3, "Input image must contain three channel rgb data.");
+				MP_ASSIGN_OR_RETURN(auto image_frame, CreateImageFrame(value, copy));
+				return std::make_shared<Packet>(mediapipe::Adopt(image_frame.release()));
+			}
+		}
+
+		MP_ASSERT_RETURN_IF_ERROR(false, "data is neither a matrix nor an image frame");
+	}
+
+	template<>
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<Packet>> MakeInputPacket<PacketDataType::PROTO_LIST>(const ::LUA_MODULE_NAME::Object& data, bool copy) {
+		MP_ASSERT_RETURN_IF_ERROR(false,
+			"SolutionBase can only process non-proto-list data. "
+			<< StringifyPacketDataType(PacketDataType::PROTO_LIST) <<
+			"type is not supported yet."
+		);
+	}
+
+	/**
+	 * Gets the content of an output stream packet of a statically known data type.
+	 */
+	template<PacketDataType packet_data_type>
+	[[nodiscard]] absl::StatusOr<::LUA_MODULE_NAME::Object> GetOutputContent(const Packet& output_packet, bool writable) {
+		return GetPacketContent(packet_data_type, output_packet, writable);
+	}
+
+#define PACKET_DATA_TYPE_CASE(fn, type) case PacketDataType::type: return &fn<PacketDataType::type>
+
+	InputPacketCreator GetInputPacketCreator(PacketDataType packet_data_type) {
+		switch (packet_data_type) {
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, STRING);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, BOOL);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, BOOL_LIST);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, INT);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, INT_LIST);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, FLOAT);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, FLOAT_LIST);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, AUDIO);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, IMAGE);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, IMAGE_LIST);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, IMAGE_FRAME);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, PROTO);
+			PACKET_DATA_TYPE_CASE(MakeInputPacket, PROTO_LIST);
+		default:
+			return nullptr;
+		}
+	}
+
+	OutputContentGetter GetOutputContentGetter(PacketDataType packet_data_type) {
+		switch (packet_data_type) {
+			PACKET_DATA_TYPE_CASE(GetOutputContent, STRING);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, BOOL);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, BOOL_LIST);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, INT);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, INT_LIST);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, FLOAT);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, FLOAT_LIST);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, AUDIO);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, IMAGE);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, IMAGE_LIST);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, IMAGE_FRAME);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, PROTO);
+			PACKET_DATA_TYPE_CASE(GetOutputContent, PROTO_LIST);
+		default:
+			return nullptr;
+		}
+	}
+
+#undef PACKET_DATA_TYPE_CASE
+
 	/**
 	 * Gets graph interface type information and returns the canonical graph config proto.
 	 * 
@@ -671,6 +808,81 @@ namespace {
 		return canonical_graph_config_proto;
 	}
 
+	/**
+	 * Same as InitializeGraphInterface, but reuses the expanded graph config and the type information
+	 * of a previous solution created from the same graph and interface.
+	 * Calculator params and graph options are applied on the expanded config, they are not part of the key.
+	 */
+	[[nodiscard]] absl::StatusOr<CalculatorGraphConfig> GetCachedGraphInterface(
+		const CalculatorGraphConfig& graph_config,
+		const std::map<std::string, ::LUA_MODULE_NAME::Object>& side_inputs,
+		const std::vector<std::string>& outputs,
+		const std::map<std::string, PacketDataType>& stream_type_hints,
+		const std::map<std::string, PacketDataType>& side_packet_type_hints,
+		std::map<std::string, PacketDataType>& input_stream_type_info,
+		std::map<std::string, PacketDataType>& output_stream_type_info,
+		std::map<std::string, PacketDataType>& side_input_type_info
+	) {
+		std::ostringstream key;
+		key << graph_config_cache::SerializeDeterministic(graph_config) << '\0';
+		for (const auto& [name, data] : side_inputs) {
+			key << name << ',';
+		}
+		key << '\0';
+		for (const auto& name : outputs) {
+			key << name << ',';
+		}
+		key << '\0';
+		for (const auto& [name, packet_data_type] : stream_type_hints) {
+			key << name << '=' << static_cast<int>(packet_data_type) << ',';
+		}
+		key << '\0';
+		for (const auto& [name, packet_data_type] : side_packet_type_hints) {
+			key << name << '=' << static_cast<int>(packet_data_type) << ',';
+		}
+
+		const auto cache_key = key.str();
+
+		if (auto entry = graph_config_cache::Lookup(cache_key)) {
+			for (const auto& [name, packet_data_type] : entry->input_stream_types) {
+				input_stream_type_info[name] = static_cast<PacketDataType>(packet_data_type);
+			}
+			for (const auto& [name, packet_data_type] : entry->output_stream_types) {
+				output_stream_type_info[name] = static_cast<PacketDataType>(packet_data_type);
+			}
+			for (const auto& [name, packet_data_type] : entry->side_input_types) {
+				side_input_type_info[name] = static_cast<PacketDataType>(packet_data_type);
+			}
+			return entry->config;
+		}
+
+		MP_ASSIGN_OR_RETURN(auto canonical_graph_config_proto, InitializeGraphInterface(
+			graph_config,
+			side_inputs,
+			outputs,
+			stream_type_hints,
+			side_packet_type_hints,
+			input_stream_type_info,
+			output_stream_type_info,
+			side_input_type_info
+		));
+
+		auto entry = std::make_shared<graph_config_cache::CachedGraphConfig>();
+		entry->config = canonical_graph_config_proto;
+		for (const auto& [name, packet_data_type] : input_stream_type_info) {
+			entry->input_stream_types[name] = static_cast<int>(packet_data_type);
+		}
+		for (const auto& [name, packet_data_type] : output_stream_type_info) {
+			entry->output_stream_types[name] = static_cast<int>(packet_data_type);
+		}
+		for (const auto& [name, packet_data_type] : side_input_type_info) {
+			entry->side_input_types[name] = static_cast<int>(packet_data_type);
+		}
+		graph_config_cache::Insert(cache_key, std::move(entry));
+
+		return canonical_graph_config_proto;
+	}
+
 	[[nodiscard]] absl::Status _create_graph_options(Message& options_message, const std::map<std::string, ::LUA_MODULE_NAME::Object>& values) {
 		for (const auto& [field, value] : values) {
 			auto fields = split(field, ".");
@@ -787,110 +999,295 @@ namespace mediapipe::lua::solution_base {
 		);
 	}
 
-	absl::Status SolutionBase::process(const cv::Mat& input_data, std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs) {
-		MP_ASSERT_RETURN_IF_ERROR(m_input_stream_type_info.size() != 0,
-			"_input_stream_type_info is None in SolutionBase");
-		MP_ASSERT_RETURN_IF_ERROR(m_input_stream_type_info.size() == 1,
-			"Can't process single image input since the graph has more than one input streams.");
+	template<typename InputData, typename Outputs>
+	absl::Status SolutionBase::ProcessAndCollect(const InputData& input_data, Outputs& solution_outputs) {
+		MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(m_graph),
+			"_graph is None in SolutionBase");
 
-		::LUA_MODULE_NAME::Object input_data_object(input_data);
-		std::map<std::string, ::LUA_MODULE_NAME::Object> input_dict;
-		for (const auto& pair : m_input_stream_type_info) {
-			input_dict[pair.first] = input_data_object;
+		// The graph is done with the inputs when process returns,
+		// images can be borrowed from the caller instead of being copied.
+		MP_ASSIGN_OR_RETURN(auto input_packets, CreateInputPackets(input_data, false));
+		MP_ASSIGN_OR_RETURN(auto graph_outputs, ProcessPackets(std::move(input_packets)));
+		return CollectOutputs(graph_outputs, solution_outputs);
+	}
+
+	template<typename InputData>
+	absl::StatusOr<int64_t> SolutionBase::SubmitInputs(const InputData& input_data) {
+		MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(m_graph),
+			"_graph is None in SolutionBase");
+
+		// Only the oldest frames can be settled.
+		// Waiting for the frame which is max_in_flight frames behind
+		// ensures that at most max_in_flight - 1 frames are still in the graph.
+		if (m_in_flight.size() >= static_cast<size_t>(m_max_in_flight)) {
+			MP_RETURN_IF_ERROR(WaitUntilSettled(m_in_flight[m_in_flight.size() - m_max_in_flight]));
 		}
 
-		return process(input_dict, solution_outputs);
+		MP_ASSIGN_OR_RETURN(auto input_packets, CreateInputPackets(input_data, true));
+
+		m_simulated_timestamp += 33333;
+		MP_RETURN_IF_ERROR(AddInputPackets(std::move(input_packets), Timestamp(m_simulated_timestamp)));
+		m_in_flight.push_back(m_simulated_timestamp);
+
+		return m_simulated_timestamp;
+	}
+
+	absl::Status SolutionBase::process(const cv::Mat& input_data, std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs) {
+		return ProcessAndCollect(input_data, solution_outputs);
 	}
 
 	absl::Status SolutionBase::process(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data, std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs) {
-		m_graph_outputs.clear();
+		return ProcessAndCollect(input_data, solution_outputs);
+	}
 
-		// Set the timestamp increment to 33333 us to simulate the 30 fps video
-		// input.
-		m_simulated_timestamp += 33333;
-		const auto simulated_timestamp = Timestamp(m_simulated_timestamp);
+	absl::Status SolutionBase::process_indexed(const std::vector<::LUA_MODULE_NAME::Object>& input_data, std::vector<::LUA_MODULE_NAME::Object>& solution_outputs) {
+		return ProcessAndCollect(input_data, solution_outputs);
+	}
+
+	std::vector<std::string> SolutionBase::get_input_stream_names() const {
+		std::vector<std::string> names;
+		names.reserve(m_input_slots.size());
+		for (const auto& slot : m_input_slots) {
+			names.push_back(slot.name);
+		}
+		return names;
+	}
 
+	std::vector<std::string> SolutionBase::get_output_stream_names() const {
+		std::vector<std::string> names;
+		names.reserve(m_output_slots.size());
+		for (const auto& slot : m_output_slots) {
+			names.push_back(slot.name);
+		}
+		return names;
+	}
+
+	absl::StatusOr<int64_t> SolutionBase::submit(const cv::Mat& input_data) {
+		return SubmitInputs(input_data);
+	}
+
+	absl::StatusOr<int64_t> SolutionBase::submit(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data) {
+		return SubmitInputs(input_data);
+	}
+
+	absl::StatusOr<bool> SolutionBase::poll(std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs, bool block) {
 		MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(m_graph),
 			"_graph is None in SolutionBase");
 
-		for (auto const& [stream_name, data] : input_data) {
-			const auto& input_stream_type = m_input_stream_type_info[stream_name];
-
-			switch (input_stream_type) {
-			case PacketDataType::PROTO_LIST:
-				MP_ASSERT_RETURN_IF_ERROR(false,
-					"SolutionBase can only process non-proto-list data. "
-					<< StringifyPacketDataType(m_input_stream_type_info[stream_name]) <<
-					"type is not supported yet."
-				);
-				break;
-			case PacketDataType::IMAGE:
+		if (m_in_flight.empty()) {
+			return false;
+		}
+
+		const auto timestamp = m_in_flight.front();
+
+		if (block) {
+			MP_RETURN_IF_ERROR(WaitUntilSettled(timestamp));
+		}
+		else {
+			bool settled;
 			{
-				bool is_valid;
-				auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<Image*>(nullptr), is_valid);
-				if (is_valid) {
-					decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<Image*>(nullptr));
-					MP_ASSERT_RETURN_IF_ERROR(value.channels() == 3, "Input image must contain three channel rgb data.");
-					break;
-				}
+				absl::MutexLock lock(&m_outputs_mutex);
+				settled = IsSettled(timestamp);
 			}
-			{
-				bool is_valid;
-				auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<cv::Mat*>(nullptr), is_valid);
-				if (is_valid) {
-					decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<cv::Mat*>(nullptr));
-					MP_ASSERT_RETURN_IF_ERROR(value.channels() == 3, "Input image must contain three channel rgb data.");
+
+			if (!settled) {
+				if (m_graph->HasError()) {
+					MP_RETURN_IF_ERROR(m_graph->WaitUntilIdle());
 				}
-				break;
+				return false;
 			}
-			case PacketDataType::IMAGE_FRAME:
-			{
-				bool is_valid;
-				auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<ImageFrame*>(nullptr), is_valid);
-				if (is_valid) {
-					decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<ImageFrame*>(nullptr));
-					MP_ASSERT_RETURN_IF_ERROR(value.NumberOfChannels() == 3, "Input image must contain three channel rgb data.");
-					break;
-				}
+		}
+
+		m_in_flight.pop_front();
+		MP_RETURN_IF_ERROR(CollectOutputs(TakeOutputPackets(timestamp), solution_outputs));
+		return true;
+	}
+
+	absl::Status SolutionBase::drain(std::vector<std::map<std::string, ::LUA_MODULE_NAME::Object>>& solution_outputs) {
+		MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(m_graph),
+			"_graph is None in SolutionBase");
+
+		MP_RETURN_IF_ERROR(m_graph->WaitUntilIdle());
+
+		solution_outputs.clear();
+		solution_outputs.reserve(m_in_flight.size());
+
+		while (!m_in_flight.empty()) {
+			const auto timestamp = m_in_flight.front();
+			m_in_flight.pop_front();
+			MP_RETURN_IF_ERROR(CollectOutputs(TakeOutputPackets(timestamp), solution_outputs.emplace_back()));
+		}
+
+		return absl::OkStatus();
+	}
+
+	absl::Status SolutionBase::set_max_in_flight(int max_in_flight) {
+		MP_ASSERT_RETURN_IF_ERROR(max_in_flight >= 1, "max_in_flight must be greater than 0");
+		m_max_in_flight = max_in_flight;
+		return absl::OkStatus();
+	}
+
+	absl::StatusOr<std::vector<Packet>> SolutionBase::CreateInputPackets(const cv::Mat& input_data, bool copy) {
+		MP_ASSERT_RETURN_IF_ERROR(m_input_slots.size() != 0,
+			"_input_stream_type_info is None in SolutionBase");
+		MP_ASSERT_RETURN_IF_ERROR(m_input_slots.size() == 1,
+			"Can't process single image input since the graph has more than one input streams.");
+
+		std::vector<Packet> input_packets(1);
+		MP_ASSIGN_OR_RETURN(input_packets[0], CreateInputPacket(m_input_slots[0], ::LUA_MODULE_NAME::Object(input_data), copy));
+		return input_packets;
+	}
+
+	absl::StatusOr<std::vector<Packet>> SolutionBase::CreateInputPackets(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data, bool copy) {
+		std::vector<Packet> input_packets(m_input_slots.size());
+
+		// Both input_data and m_input_slots are sorted by stream name:
+		// walk them together instead of looking up each stream.
+		size_t i = 0;
+		for (auto const& [stream_name, data] : input_data) {
+			while (i < m_input_slots.size() && m_input_slots[i].name < stream_name) {
+				++i;
 			}
-			{
-				bool is_valid;
-				auto value_holder = ::LUA_MODULE_NAME::lua_to(data, static_cast<cv::Mat*>(nullptr), is_valid);
-				if (is_valid) {
-					decltype(auto) value = ::LUA_MODULE_NAME::extract_holder(value_holder, static_cast<cv::Mat*>(nullptr));
-					MP_ASSERT_RETURN_IF_ERROR(value.channels() == 3, "Input image must contain three channel rgb data.");
-				}
-				break;
+
+			MP_ASSERT_RETURN_IF_ERROR(i < m_input_slots.size() && m_input_slots[i].name == stream_name,
+				"'" << stream_name << "' is not an input stream of the graph");
+
+			MP_ASSIGN_OR_RETURN(input_packets[i], CreateInputPacket(m_input_slots[i], data, copy));
+		}
+
+		return input_packets;
+	}
+
+	absl::StatusOr<std::vector<Packet>> SolutionBase::CreateInputPackets(const std::vector<::LUA_MODULE_NAME::Object>& input_data, bool copy) {
+		MP_ASSERT_RETURN_IF_ERROR(input_data.size() == m_input_slots.size(),
+			"Expecting " << m_input_slots.size() << " inputs, got " << input_data.size());
+
+		std::vector<Packet> input_packets(m_input_slots.size());
+
+		for (size_t i = 0; i < input_data.size(); i++) {
+			if (input_data[i].isnil()) {
+				continue;
 			}
+			MP_ASSIGN_OR_RETURN(input_packets[i], CreateInputPacket(m_input_slots[i], input_data[i], copy));
+		}
+
+		return input_packets;
+	}
+
+	absl::StatusOr<std::vector<Packet>> SolutionBase::ProcessPackets(std::vector<Packet>&& input_packets) {
+		MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(m_graph),
+			"_graph is None in SolutionBase");
+		MP_ASSERT_RETURN_IF_ERROR(m_in_flight.empty(),
+			"process() cannot be called while submitted frames are pending. Call drain() first.");
+
+		// Set the timestamp increment to 33333 us to simulate the 30 fps video
+		// input.
+		m_simulated_timestamp += 33333;
+
+		MP_RETURN_IF_ERROR(AddInputPackets(std::move(input_packets), Timestamp(m_simulated_timestamp)));
+		MP_RETURN_IF_ERROR(m_graph->WaitUntilIdle());
+		return TakeOutputPackets(m_simulated_timestamp);
+	}
+
+	absl::StatusOr<Packet> SolutionBase::CreateInputPacket(const InputStreamSlot& slot, const ::LUA_MODULE_NAME::Object& data, bool copy) {
+		MP_ASSIGN_OR_RETURN(auto packet_shared, slot.create_packet(data, copy));
+		MP_ASSERT_RETURN_IF_ERROR(packet_shared.use_count() == 1, "Packet must have a unique holder");
+		return std::move(*packet_shared.get());
+	}
+
+	absl::Status SolutionBase::AddInputPackets(std::vector<Packet>&& input_packets, const Timestamp& timestamp) {
+		for (size_t i = 0; i < input_packets.size(); i++) {
+			if (input_packets[i].IsEmpty()) {
+				continue;
 			}
+			MP_RETURN_IF_ERROR(m_graph->AddPacketToInputStream(m_input_slots[i].name, std::move(input_packets[i]).At(timestamp)));
+		}
+
+		return absl::OkStatus();
+	}
+
+	std::vector<Packet> SolutionBase::TakeOutputPackets(int64_t timestamp) {
+		std::vector<Packet> graph_outputs;
 
-			MP_ASSIGN_OR_RETURN(auto packet_shared, ::MakePacket(input_stream_type, data));
-			MP_ASSERT_RETURN_IF_ERROR(packet_shared.use_count() == 1, "Packet must have a unique holder");
-			auto packet = std::move(*packet_shared.get()).At(simulated_timestamp);
-			MP_RETURN_IF_ERROR(m_graph->AddPacketToInputStream(stream_name, std::move(packet)));
+		absl::MutexLock lock(&m_outputs_mutex);
+		auto found = m_graph_outputs.find(timestamp);
+		if (found != m_graph_outputs.end()) {
+			graph_outputs = std::move(found->second);
 		}
 
-		MP_RETURN_IF_ERROR(m_graph->WaitUntilIdle());
+		// Outputs of older timestamps will never be requested
+		m_graph_outputs.erase(m_graph_outputs.begin(), m_graph_outputs.upper_bound(timestamp));
+
+		return graph_outputs;
+	}
 
+	absl::Status SolutionBase::CollectOutputs(const std::vector<Packet>& graph_outputs, std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs) {
 		// Create a NamedTuple object where the field names are mapping to the graph
 		// output stream names.
-		MP_ASSERT_RETURN_IF_ERROR(m_output_stream_type_info.size() != 0,
+		MP_ASSERT_RETURN_IF_ERROR(m_output_slots.size() != 0,
 			"_output_stream_type_info is None in SolutionBase");
 
 		solution_outputs.clear();
 
-		for (auto const& [stream_name, packet_data_type] : m_output_stream_type_info) {
-			if (m_graph_outputs.count(stream_name)) {
-				MP_ASSIGN_OR_RETURN(solution_outputs[stream_name], GetPacketContent(packet_data_type, m_graph_outputs[stream_name]));
+		// m_output_slots is sorted by stream name, hint the insertion position
+		for (size_t i = 0; i < m_output_slots.size(); i++) {
+			const auto& slot = m_output_slots[i];
+			auto it = solution_outputs.emplace_hint(solution_outputs.end(), slot.name, None);
+			if (i < graph_outputs.size() && !graph_outputs[i].IsEmpty()) {
+				MP_ASSIGN_OR_RETURN(it->second, slot.get_content(graph_outputs[i], m_writable_outputs));
 			}
-			else {
-				solution_outputs[stream_name] = None;
+		}
+
+		return absl::OkStatus();
+	}
+
+	absl::Status SolutionBase::CollectOutputs(const std::vector<Packet>& graph_outputs, std::vector<::LUA_MODULE_NAME::Object>& solution_outputs) {
+		MP_ASSERT_RETURN_IF_ERROR(m_output_slots.size() != 0,
+			"_output_stream_type_info is None in SolutionBase");
+
+		solution_outputs.assign(m_output_slots.size(), None);
+
+		for (size_t i = 0; i < graph_outputs.size(); i++) {
+			if (!graph_outputs[i].IsEmpty()) {
+				MP_ASSIGN_OR_RETURN(solution_outputs[i], m_output_slots[i].get_content(graph_outputs[i], m_writable_outputs));
 			}
 		}
 
 		return absl::OkStatus();
 	}
 
+	bool SolutionBase::IsSettled(int64_t timestamp) const {
+		const auto settled_timestamp = Timestamp(timestamp);
+		for (const auto& bound : m_output_bounds) {
+			if (bound < settled_timestamp) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	absl::Status SolutionBase::WaitUntilSettled(int64_t timestamp) {
+		bool has_error = false;
+
+		{
+			absl::MutexLock lock(&m_outputs_mutex);
+			while (!IsSettled(timestamp)) {
+				if (m_graph->HasError()) {
+					has_error = true;
+					break;
+				}
+				m_outputs_cond.WaitWithTimeout(&m_outputs_mutex, absl::Milliseconds(10));
+			}
+		}
+
+		if (has_error) {
+			MP_RETURN_IF_ERROR(m_graph->WaitUntilIdle());
+			MP_ASSERT_RETURN_IF_ERROR(false, calculator_graph::get_combined_error_message(m_graph.get()));
+		}
+
+		return absl::OkStatus();
+	}
+
 	absl::Status SolutionBase::close() {
 		MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(m_graph),
 			"Closing SolutionBase._graph which is already None");
@@ -899,12 +1296,27 @@ namespace mediapipe::lua::solution_base {
 		m_graph.reset();
 		m_input_stream_type_info.clear();
 		m_output_stream_type_info.clear();
+		m_input_slots.clear();
+		m_output_slots.clear();
+		m_in_flight.clear();
+
+		absl::MutexLock lock(&m_outputs_mutex);
+		m_graph_outputs.clear();
+		m_output_bounds.clear();
 		return absl::OkStatus();
 	}
 
 	absl::Status SolutionBase::reset() {
 		if (m_graph) {
 			MP_RETURN_IF_ERROR(calculator_graph::close(m_graph.get()));
+			m_in_flight.clear();
+
+			{
+				absl::MutexLock lock(&m_outputs_mutex);
+				m_graph_outputs.clear();
+				std::fill(m_output_bounds.begin(), m_output_bounds.end(), Timestamp::Unstarted());
+			}
+
 			MP_RETURN_IF_ERROR(m_graph->StartRun(m_input_side_packets));
 		}
 		return absl::OkStatus();
@@ -941,7 +1353,7 @@ namespace mediapipe::lua::solution_base {
 	) {
 		m_graph = std::make_unique<CalculatorGraph>();
 
-		MP_ASSIGN_OR_RETURN(auto canonical_graph_config_proto, InitializeGraphInterface(
+		MP_ASSIGN_OR_RETURN(auto canonical_graph_config_proto, GetCachedGraphInterface(
 			graph_config,
 			side_inputs,
 			outputs,
@@ -960,22 +1372,71 @@ namespace mediapipe::lua::solution_base {
 			SetExtension(canonical_graph_config_proto.mutable_graph_options(), graph_options);
 		}
 
+		auto executor = shared_executor::SharedExecutor::GetExecutorOrDefault(extra_settings ? extra_settings->executor : nullptr);
+		if (executor) {
+			MP_RETURN_IF_ERROR(m_graph->SetExecutor("", executor));
+		}
+
+		// Model files are shared read-only mappings of the model asset registry
+		MP_RETURN_IF_ERROR(m_graph->SetServiceObject(
+			kResourcesService,
+			model_asset_registry::CreateResources(CreateDefaultResources())
+		));
+
 		MP_RETURN_IF_ERROR(m_graph->Initialize(canonical_graph_config_proto));
 
 		if (extra_settings && extra_settings->disallow_service_default_initialization) {
 			MP_RETURN_IF_ERROR(m_graph->DisallowServiceDefaultInitialization());
 		}
 
-		for (const auto& stream : m_output_stream_type_info) {
-			std::string stream_name = stream.first;
+		if (extra_settings) {
+			MP_RETURN_IF_ERROR(set_max_in_flight(extra_settings->max_in_flight));
+			m_writable_outputs = extra_settings->writable_outputs;
+		}
+
+		// Compile the per-stream dispatch plan
+		m_input_slots.clear();
+		m_input_slots.reserve(m_input_stream_type_info.size());
+		for (const auto& [stream_name, packet_data_type] : m_input_stream_type_info) {
+			m_input_slots.push_back({ stream_name, packet_data_type, GetInputPacketCreator(packet_data_type) });
+			MP_ASSERT_RETURN_IF_ERROR(m_input_slots.back().create_packet != nullptr,
+				"create packet data type " << StringifyPacketDataType(packet_data_type) << " is not implemented");
+		}
+
+		m_output_slots.clear();
+		m_output_slots.reserve(m_output_stream_type_info.size());
+		for (const auto& [stream_name, packet_data_type] : m_output_stream_type_info) {
+			m_output_slots.push_back({ stream_name, packet_data_type, GetOutputContentGetter(packet_data_type) });
+			MP_ASSERT_RETURN_IF_ERROR(m_output_slots.back().get_content != nullptr,
+				"get packet content of data type " << StringifyPacketDataType(packet_data_type) << " is not implemented");
+		}
+
+		{
+			absl::MutexLock lock(&m_outputs_mutex);
+			m_output_bounds.assign(m_output_slots.size(), Timestamp::Unstarted());
+		}
 
+		const auto num_outputs = m_output_slots.size();
+		for (size_t i = 0; i < num_outputs; i++) {
 			MP_RETURN_IF_ERROR(m_graph->ObserveOutputStream(
-				stream_name,
-				std::move([this, stream_name](const Packet& output_packet) {
-					absl::MutexLock lock(&callback_mutex);
-					if (output_packet.Timestamp() == Timestamp(m_simulated_timestamp)) {
-						m_graph_outputs[stream_name] = output_packet;
+				m_output_slots[i].name,
+				std::move([this, i, num_outputs](const Packet& output_packet) {
+					absl::MutexLock lock(&m_outputs_mutex);
+					const auto timestamp = output_packet.Timestamp();
+
+					// Empty packets are timestamp bounds updates
+					if (!output_packet.IsEmpty()) {
+						auto& graph_outputs = m_graph_outputs[timestamp.Value()];
+						graph_outputs.resize(num_outputs);
+						graph_outputs[i] = output_packet;
+					}
+
+					auto& bound = m_output_bounds[i];
+					if (bound < timestamp) {
+						bound = timestamp;
 					}
+
+					m_outputs_cond.SignalAll();
 					return absl::OkStatus();
 					}),
 				true
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <deque>
 #include <filesystem>
 #include <opencv2/core/mat.hpp>
+#include "absl/synchronization/mutex.h"
 
 #include "binding/calculator_graph.h"
 #include "binding/resource_util.h"
+#include "binding/shared_executor.h"
 #include "binding/validated_graph_config.h"
 
 #include <lua_bridge_common.hdr.hpp>
@@ -60,17 +63,46 @@ namespace mediapipe::lua::solution_base {
 #pragma pop_macro("INT")
 #pragma pop_macro("BOOL")
 
+	using InputPacketCreator = absl::StatusOr<std::shared_ptr<Packet>>(*)(const ::LUA_MODULE_NAME::Object& data, bool copy);
+	using OutputContentGetter = absl::StatusOr<::LUA_MODULE_NAME::Object>(*)(const Packet& packet, bool writable);
+
+	// Per-stream dispatch entries, resolved once when the graph is initialized
+	struct InputStreamSlot {
+		std::string name;
+		PacketDataType type;
+		InputPacketCreator create_packet;
+	};
+
+	struct OutputStreamSlot {
+		std::string name;
+		PacketDataType type;
+		OutputContentGetter get_content;
+	};
+
 	const std::map<std::string, ::LUA_MODULE_NAME::Object>& noMap();
 	const std::map<std::string, PacketDataType>& noTypeMap();
 	const std::vector<std::string>& noVector();
 
 	struct CV_EXPORTS_W_SIMPLE ExtraSettings {
 		CV_WRAP ExtraSettings(
-			bool disallow_service_default_initialization = false
-		) : disallow_service_default_initialization(disallow_service_default_initialization) {}
+			bool disallow_service_default_initialization = false,
+			int max_in_flight = 1,
+			bool writable_outputs = false,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>()
+		) :
+			disallow_service_default_initialization(disallow_service_default_initialization),
+			max_in_flight(max_in_flight),
+			writable_outputs(writable_outputs),
+			executor(executor)
+		{}
 		CV_WRAP ExtraSettings(const ExtraSettings& other) = default;
 
 		CV_PROP_RW bool disallow_service_default_initialization;
+		CV_PROP_RW int max_in_flight;
+		// Image outputs share the content of the graph packets unless writable_outputs is true, proto outputs are always copied
+		CV_PROP_RW bool writable_outputs;
+		// Executor the graph runs on, the process-wide default when not set
+		CV_PROP_RW std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor> executor;
 	};
 
 	class CV_EXPORTS_W SolutionBase {
@@ -158,6 +190,55 @@ namespace mediapipe::lua::solution_base {
 		CV_WRAP [[nodiscard]] absl::Status process(const cv::Mat& input_data, CV_OUT std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs);
 		CV_WRAP [[nodiscard]] absl::Status process(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data, CV_OUT std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs);
 
+		/**
+		 * Processes positional inputs.
+		 *
+		 *  Args:
+		 *    input_data: one value per input stream, in the order of get_input_stream_names().
+		 *    solution_outputs: one value per output stream, in the order of get_output_stream_names().
+		 */
+		CV_WRAP [[nodiscard]] absl::Status process_indexed(const std::vector<::LUA_MODULE_NAME::Object>& input_data, CV_OUT std::vector<::LUA_MODULE_NAME::Object>& solution_outputs);
+
+		CV_WRAP std::vector<std::string> get_input_stream_names() const;
+		CV_WRAP std::vector<std::string> get_output_stream_names() const;
+
+		/**
+		 * Sends a frame into the graph without waiting for its outputs.
+		 *
+		 * Blocks only while max_in_flight frames are still being processed by the graph.
+		 * Image inputs are copied, so the caller can reuse its buffers right away.
+		 *
+		 *  Returns:
+		 *    the timestamp assigned to the frame.
+		 */
+		CV_WRAP [[nodiscard]] absl::StatusOr<int64_t> submit(const cv::Mat& input_data);
+		CV_WRAP [[nodiscard]] absl::StatusOr<int64_t> submit(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data);
+
+		/**
+		 * Retrieves the outputs of the oldest submitted frame.
+		 *
+		 *  Args:
+		 *    block: wait for the oldest frame to be processed instead of returning immediately.
+		 *
+		 *  Returns:
+		 *    true if solution_outputs has been filled, false if the oldest frame is not ready yet
+		 *    or if there is no submitted frame.
+		 */
+		CV_WRAP [[nodiscard]] absl::StatusOr<bool> poll(CV_OUT std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs, bool block = false);
+
+		/**
+		 * Waits for all the submitted frames and retrieves their outputs in submission order.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status drain(CV_OUT std::vector<std::map<std::string, ::LUA_MODULE_NAME::Object>>& solution_outputs);
+
+		/**
+		 * Sets the maximum number of frames that submit() lets into the graph at once.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status set_max_in_flight(int max_in_flight);
+		CV_WRAP int get_max_in_flight() const {
+			return m_max_in_flight;
+		}
+
 		/**
 		 * Closes all the input sources and the graph.
 		 */
@@ -185,6 +266,17 @@ namespace mediapipe::lua::solution_base {
 
 		virtual ~SolutionBase();
 
+		// Packet level processing, used to run the graph outside of the lua thread.
+		// CreateInputPackets and CollectOutputs convert lua values and must be called from the lua thread,
+		// ProcessPackets only deals with packets and can be called from any thread,
+		// as long as calls on the same instance are not concurrent.
+		[[nodiscard]] absl::StatusOr<std::vector<Packet>> CreateInputPackets(const cv::Mat& input_data, bool copy);
+		[[nodiscard]] absl::StatusOr<std::vector<Packet>> CreateInputPackets(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data, bool copy);
+		[[nodiscard]] absl::StatusOr<std::vector<Packet>> CreateInputPackets(const std::vector<::LUA_MODULE_NAME::Object>& input_data, bool copy);
+		[[nodiscard]] absl::StatusOr<std::vector<Packet>> ProcessPackets(std::vector<Packet>&& input_packets);
+		[[nodiscard]] absl::Status CollectOutputs(const std::vector<Packet>& graph_outputs, std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs);
+		[[nodiscard]] absl::Status CollectOutputs(const std::vector<Packet>& graph_outputs, std::vector<::LUA_MODULE_NAME::Object>& solution_outputs);
+
 	private:
 		// since I don't know the copy behaviour
 		// disable it
@@ -202,6 +294,17 @@ namespace mediapipe::lua::solution_base {
 			const std::optional<ExtraSettings>& extra_settings
 		);
 
+		template<typename InputData, typename Outputs>
+		[[nodiscard]] absl::Status ProcessAndCollect(const InputData& input_data, Outputs& solution_outputs);
+		template<typename InputData>
+		[[nodiscard]] absl::StatusOr<int64_t> SubmitInputs(const InputData& input_data);
+
+		[[nodiscard]] absl::StatusOr<Packet> CreateInputPacket(const InputStreamSlot& slot, const ::LUA_MODULE_NAME::Object& data, bool copy);
+		[[nodiscard]] absl::Status AddInputPackets(std::vector<Packet>&& input_packets, const Timestamp& timestamp);
+		std::vector<Packet> TakeOutputPackets(int64_t timestamp);
+		bool IsSettled(int64_t timestamp) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(m_outputs_mutex);
+		[[nodiscard]] absl::Status WaitUntilSettled(int64_t timestamp);
+
 		inline static const std::string GetResourcePath(const std::string& binary_graph_path) {
 			namespace fs = std::filesystem;
 			fs::path root_path(mediapipe::lua::_framework_bindings::resource_util::get_resource_dir());
@@ -212,9 +315,26 @@ namespace mediapipe::lua::solution_base {
 		std::map<std::string, PacketDataType> m_output_stream_type_info;
 		std::map<std::string, PacketDataType> m_side_input_type_info;
 
+		// Sorted by stream name, like the type info maps they are compiled from
+		std::vector<InputStreamSlot> m_input_slots;
+		std::vector<OutputStreamSlot> m_output_slots;
+
 		std::unique_ptr<CalculatorGraph> m_graph;
 		int64_t m_simulated_timestamp = 0;
-		std::map<std::string, Packet> m_graph_outputs;
 		std::map<std::string, Packet> m_input_side_packets;
+
+		// Pipelined execution state.
+		// Output packets are matched to the submitted frames by timestamp.
+		// A frame is settled once every output stream has reached its timestamp,
+		// either with a packet or with a timestamp bound.
+		int m_max_in_flight = 1;
+		bool m_writable_outputs = false;
+		std::deque<int64_t> m_in_flight;
+
+		// Shared between the output stream observers of this graph and the caller thread only
+		mutable absl::Mutex m_outputs_mutex;
+		absl::CondVar m_outputs_cond;
+		std::map<int64_t, std::vector<Packet>> m_graph_outputs ABSL_GUARDED_BY(m_outputs_mutex);
+		std::vector<Timestamp> m_output_bounds ABSL_GUARDED_BY(m_outputs_mutex);
 	};
 }
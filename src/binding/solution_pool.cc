@@ -0,0 +1,162 @@
+#include "binding/solution_pool.h"
+
+namespace mediapipe::lua::solution_pool {
+	using solution_base::SolutionBase;
+
+	SolutionPool::SolutionPool(
+		const std::vector<std::shared_ptr<SolutionBase>>& solutions,
+		instance_pool::DispatchPolicy dispatch_policy
+	) {
+		m_pool = std::make_unique<instance_pool::InstancePool<SolutionBase, Request, Response>>(
+			solutions,
+			[](SolutionBase& solution, Request&& request) -> absl::StatusOr<Response> {
+				MP_ASSIGN_OR_RETURN(auto graph_outputs, solution.ProcessPackets(std::move(request.input_packets)));
+				return Response{ request.instance, std::move(graph_outputs) };
+			},
+			dispatch_policy
+		);
+	}
+
+	template<typename Graph>
+	absl::StatusOr<std::shared_ptr<SolutionPool>> SolutionPool::CreateInstances(
+		const Graph& graph,
+		int num_instances,
+		const std::map<std::string, ::LUA_MODULE_NAME::Object>& calculator_params,
+		const std::shared_ptr<google::protobuf::Message>& graph_options,
+		const std::map<std::string, ::LUA_MODULE_NAME::Object>& side_inputs,
+		const std::vector<std::string>& outputs,
+		const std::map<std::string, solution_base::PacketDataType>& stream_type_hints,
+		const std::map<std::string, solution_base::PacketDataType>& side_packet_type_hints,
+		const std::optional<solution_base::ExtraSettings>& extra_settings,
+		instance_pool::DispatchPolicy dispatch_policy
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(num_instances >= 1, "num_instances must be greater than 0");
+
+		std::vector<std::shared_ptr<SolutionBase>> solutions;
+		solutions.reserve(num_instances);
+		for (int i = 0; i < num_instances; i++) {
+			MP_ASSIGN_OR_RETURN(auto solution, SolutionBase::create(
+				graph,
+				calculator_params,
+				graph_options,
+				side_inputs,
+				outputs,
+				stream_type_hints,
+				side_packet_type_hints,
+				extra_settings
+			));
+			solutions.push_back(std::move(solution));
+		}
+
+		return std::make_shared<SolutionPool>(solutions, dispatch_policy);
+	}
+
+	absl::StatusOr<std::shared_ptr<SolutionPool>> SolutionPool::create(
+		const std::string& binary_graph_path,
+		int num_instances,
+		const std::map<std::string, ::LUA_MODULE_NAME::Object>& calculator_params,
+		const std::shared_ptr<google::protobuf::Message>& graph_options,
+		const std::map<std::string, ::LUA_MODULE_NAME::Object>& side_inputs,
+		const std::vector<std::string>& outputs,
+		const std::map<std::string, solution_base::PacketDataType>& stream_type_hints,
+		const std::map<std::string, solution_base::PacketDataType>& side_packet_type_hints,
+		const std::optional<solution_base::ExtraSettings>& extra_settings,
+		instance_pool::DispatchPolicy dispatch_policy
+	) {
+		return CreateInstances(
+			binary_graph_path,
+			num_instances,
+			calculator_params,
+			graph_options,
+			side_inputs,
+			outputs,
+			stream_type_hints,
+			side_packet_type_hints,
+			extra_settings,
+			dispatch_policy
+		);
+	}
+
+	absl::StatusOr<std::shared_ptr<SolutionPool>> SolutionPool::create(
+		const CalculatorGraphConfig& graph_config,
+		int num_instances,
+		const std::map<std::string, ::LUA_MODULE_NAME::Object>& calculator_params,
+		const std::shared_ptr<google::protobuf::Message>& graph_options,
+		const std::map<std::string, ::LUA_MODULE_NAME::Object>& side_inputs,
+		const std::vector<std::string>& outputs,
+		const std::map<std::string, solution_base::PacketDataType>& stream_type_hints,
+		const std::map<std::string, solution_base::PacketDataType>& side_packet_type_hints,
+		const std::optional<solution_base::ExtraSettings>& extra_settings,
+		instance_pool::DispatchPolicy dispatch_policy
+	) {
+		return CreateInstances(
+			graph_config,
+			num_instances,
+			calculator_params,
+			graph_options,
+			side_inputs,
+			outputs,
+			stream_type_hints,
+			side_packet_type_hints,
+			extra_settings,
+			dispatch_policy
+		);
+	}
+
+	absl::StatusOr<std::shared_ptr<SolutionPool>> SolutionPool::create(
+		const std::vector<std::shared_ptr<SolutionBase>>& solutions,
+		instance_pool::DispatchPolicy dispatch_policy
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(!solutions.empty(), "At least one solution is required");
+		for (const auto& solution : solutions) {
+			MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(solution), "solution cannot be None");
+		}
+		return std::make_shared<SolutionPool>(solutions, dispatch_policy);
+	}
+
+	template<typename InputData>
+	absl::StatusOr<int64_t> SolutionPool::SubmitInputs(const InputData& input_data) {
+		const auto instance = m_pool->Dispatch();
+
+		// Packets are created on the lua thread,
+		// the worker thread only deals with the graph
+		MP_ASSIGN_OR_RETURN(auto input_packets, m_pool->at(instance).CreateInputPackets(input_data, true));
+		return m_pool->Enqueue(instance, Request{ instance, std::move(input_packets) });
+	}
+
+	absl::StatusOr<int64_t> SolutionPool::submit(const cv::Mat& input_data) {
+		return SubmitInputs(input_data);
+	}
+
+	absl::StatusOr<int64_t> SolutionPool::submit(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data) {
+		return SubmitInputs(input_data);
+	}
+
+	absl::StatusOr<bool> SolutionPool::poll(
+		std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs,
+		int64_t& request_id,
+		bool block
+	) {
+		absl::StatusOr<Response> response;
+		if (!m_pool->Poll(request_id, response, block)) {
+			return false;
+		}
+
+		MP_RETURN_IF_ERROR(response.status());
+		MP_RETURN_IF_ERROR(m_pool->at(response->instance).CollectOutputs(response->graph_outputs, solution_outputs));
+		return true;
+	}
+
+	absl::Status SolutionPool::drain(std::vector<std::map<std::string, ::LUA_MODULE_NAME::Object>>& solution_outputs) {
+		solution_outputs.clear();
+		solution_outputs.reserve(m_pool->pending());
+
+		int64_t request_id;
+		while (m_pool->pending() != 0) {
+			MP_ASSIGN_OR_RETURN(auto polled, poll(solution_outputs.emplace_back(), request_id, true));
+			MP_ASSERT_RETURN_IF_ERROR(polled, "Expecting the outputs of a pending request");
+		}
+
+		return absl::OkStatus();
+	}
+}
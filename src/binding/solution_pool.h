@@ -0,0 +1,127 @@
+#pragma once
+
+#include "binding/instance_pool.h"
+#include "binding/solution_base.h"
+
+namespace mediapipe::lua::solution_pool {
+	/**
+	 * Shards frames across independent solutions, each one driven by its own native worker thread.
+	 *
+	 * The solutions are either created by the pool from the same options, or passed in,
+	 * in which case they are expected to be created with the same options, e.g. Hands.create(...) called N times.
+	 * Once pooled, they must not be used directly anymore.
+	 */
+	class CV_EXPORTS_W SolutionPool {
+	public:
+		SolutionPool(
+			const std::vector<std::shared_ptr<solution_base::SolutionBase>>& solutions,
+			instance_pool::DispatchPolicy dispatch_policy
+		);
+
+		/**
+		 * Creates num_instances solutions with the same options, as SolutionBase.create would.
+		 */
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<SolutionPool>> create(
+			const std::string& binary_graph_path,
+			int num_instances,
+			const std::map<std::string, ::LUA_MODULE_NAME::Object>& calculator_params = solution_base::noMap(),
+			const std::shared_ptr<google::protobuf::Message>& graph_options = std::shared_ptr<google::protobuf::Message>(),
+			const std::map<std::string, ::LUA_MODULE_NAME::Object>& side_inputs = solution_base::noMap(),
+			const std::vector<std::string>& outputs = solution_base::noVector(),
+			const std::map<std::string, solution_base::PacketDataType>& stream_type_hints = solution_base::noTypeMap(),
+			const std::map<std::string, solution_base::PacketDataType>& side_packet_type_hints = solution_base::noTypeMap(),
+			const std::optional<solution_base::ExtraSettings>& extra_settings = std::nullopt,
+			instance_pool::DispatchPolicy dispatch_policy = instance_pool::DispatchPolicy::ROUND_ROBIN
+		);
+
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<SolutionPool>> create(
+			const CalculatorGraphConfig& graph_config,
+			int num_instances,
+			const std::map<std::string, ::LUA_MODULE_NAME::Object>& calculator_params = solution_base::noMap(),
+			const std::shared_ptr<google::protobuf::Message>& graph_options = std::shared_ptr<google::protobuf::Message>(),
+			const std::map<std::string, ::LUA_MODULE_NAME::Object>& side_inputs = solution_base::noMap(),
+			const std::vector<std::string>& outputs = solution_base::noVector(),
+			const std::map<std::string, solution_base::PacketDataType>& stream_type_hints = solution_base::noTypeMap(),
+			const std::map<std::string, solution_base::PacketDataType>& side_packet_type_hints = solution_base::noTypeMap(),
+			const std::optional<solution_base::ExtraSettings>& extra_settings = std::nullopt,
+			instance_pool::DispatchPolicy dispatch_policy = instance_pool::DispatchPolicy::ROUND_ROBIN
+		);
+
+		/**
+		 * Pools solutions created with the same options.
+		 */
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<SolutionPool>> create(
+			const std::vector<std::shared_ptr<solution_base::SolutionBase>>& solutions,
+			instance_pool::DispatchPolicy dispatch_policy = instance_pool::DispatchPolicy::ROUND_ROBIN
+		);
+
+		/**
+		 * Queues a frame on one of the solutions.
+		 * Image inputs are copied, so the caller can reuse its buffers right away.
+		 *
+		 *  Returns:
+		 *    the request id of the frame, ids are increasing in submission order.
+		 */
+		CV_WRAP [[nodiscard]] absl::StatusOr<int64_t> submit(const cv::Mat& input_data);
+		CV_WRAP [[nodiscard]] absl::StatusOr<int64_t> submit(const std::map<std::string, ::LUA_MODULE_NAME::Object>& input_data);
+
+		/**
+		 * Retrieves the outputs of the oldest submitted frame.
+		 *
+		 *  Args:
+		 *    block: wait for the oldest frame to be processed instead of returning immediately.
+		 *
+		 *  Returns:
+		 *    true if solution_outputs and request_id have been filled, false if the oldest frame
+		 *    is not ready yet or if there is no submitted frame.
+		 */
+		CV_WRAP [[nodiscard]] absl::StatusOr<bool> poll(
+			CV_OUT std::map<std::string, ::LUA_MODULE_NAME::Object>& solution_outputs,
+			CV_OUT int64_t& request_id,
+			bool block = false
+		);
+
+		/**
+		 * Waits for all the submitted frames and retrieves their outputs in submission order.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status drain(CV_OUT std::vector<std::map<std::string, ::LUA_MODULE_NAME::Object>>& solution_outputs);
+
+		CV_WRAP size_t get_num_instances() const {
+			return m_pool->size();
+		}
+
+		CV_WRAP int64_t get_num_pending() const {
+			return m_pool->pending();
+		}
+
+	private:
+		struct Request {
+			size_t instance;
+			std::vector<Packet> input_packets;
+		};
+
+		struct Response {
+			size_t instance;
+			std::vector<Packet> graph_outputs;
+		};
+
+		template<typename Graph>
+		[[nodiscard]] static absl::StatusOr<std::shared_ptr<SolutionPool>> CreateInstances(
+			const Graph& graph,
+			int num_instances,
+			const std::map<std::string, ::LUA_MODULE_NAME::Object>& calculator_params,
+			const std::shared_ptr<google::protobuf::Message>& graph_options,
+			const std::map<std::string, ::LUA_MODULE_NAME::Object>& side_inputs,
+			const std::vector<std::string>& outputs,
+			const std::map<std::string, solution_base::PacketDataType>& stream_type_hints,
+			const std::map<std::string, solution_base::PacketDataType>& side_packet_type_hints,
+			const std::optional<solution_base::ExtraSettings>& extra_settings,
+			instance_pool::DispatchPolicy dispatch_policy
+		);
+
+		template<typename InputData>
+		[[nodiscard]] absl::StatusOr<int64_t> SubmitInputs(const InputData& input_data);
+
+		std::unique_ptr<instance_pool::InstancePool<solution_base::SolutionBase, Request, Response>> m_pool;
+	};
+}
@@ -11,6 +11,7 @@ namespace {
 	using namespace mediapipe::tasks::audio::audio_classifier::proto;
 	using namespace mediapipe::tasks::lua::audio::core::audio_task_running_mode;
 	using namespace mediapipe::tasks::lua::components::containers::audio_data;
+	using namespace mediapipe::tasks::lua::components::containers::audio_file_reader;
 	using namespace mediapipe::tasks::lua::components::containers::classification_result;
 	using namespace mediapipe::tasks::lua::core::base_options;
 	using namespace mediapipe::tasks::lua::core::task_info;
@@ -65,10 +66,11 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 	absl::StatusOr<std::shared_ptr<AudioClassifier>> AudioClassifier::create(
 		const CalculatorGraphConfig& graph_config,
 		AudioTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseAudioTaskApi = core::base_audio_task_api::BaseAudioTaskApi;
-		return BaseAudioTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<AudioClassifier*>(nullptr));
+		return BaseAudioTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<AudioClassifier*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<AudioClassifier>> AudioClassifier::create_from_model_path(const std::string& model_path) {
@@ -77,10 +79,19 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 	}
 
 	absl::StatusOr<std::shared_ptr<AudioClassifier>> AudioClassifier::create_from_options(std::shared_ptr<AudioClassifierOptions> options) {
+		std::shared_ptr<components::containers::category::LabelTableCache> label_tables;
+		if (options->output_compact_categories) {
+			MP_ASSERT_RETURN_IF_ERROR(options->base_options, "base_options must be set to output compact categories");
+			MP_ASSIGN_OR_RETURN(label_tables, components::containers::category::LabelTableCache::CreateFromModel(
+				options->base_options->model_asset_path,
+				options->base_options->model_asset_buffer,
+				options->display_names_locale.value_or("en")
+			));
+		}
 		PacketsCallback packet_callback = nullptr;
 
 		if (options->result_callback) {
-			packet_callback = [options](const PacketMap& output_packets) {
+			packet_callback = [options, label_tables](const PacketMap& output_packets) {
 				auto timestamp_ms = output_packets.at(_CLASSIFICATIONS_STREAM_NAME).Timestamp().Value() / _MICRO_SECONDS_PER_MILLISECOND;
 
 				if (output_packets.at(_CLASSIFICATIONS_STREAM_NAME).IsEmpty()) {
@@ -90,7 +101,9 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 
 				MP_PACKET_ASSIGN_OR_THROW(const auto& classification_result_proto, ClassificationResult, output_packets.at(_CLASSIFICATIONS_STREAM_NAME)); // There is no other choice than throw in a callback to stop the execution
 				options->result_callback(
-					*AudioClassifierResult::create_from_pb2(classification_result_proto),
+					label_tables
+					? *AudioClassifierResult::create_from_pb2(classification_result_proto, *label_tables)
+					: *AudioClassifierResult::create_from_pb2(classification_result_proto),
 					timestamp_ms
 				);
 			};
@@ -110,26 +123,103 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 
 		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(false));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-			);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		task->_label_tables = label_tables;
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		return task;
+	}
+
+	std::shared_ptr<core::base_audio_task_api::AudioTaskFuture> AudioClassifier::create_from_options_async(std::shared_ptr<AudioClassifierOptions> options) {
+		return std::make_shared<core::base_audio_task_api::AudioTaskFuture>(options, &AudioClassifier::create_from_options);
 	}
 
 	absl::Status AudioClassifier::classify(std::vector<std::shared_ptr<AudioClassifierResult>>& output_list, const AudioData& audio_clip) {
 		MP_ASSERT_RETURN_IF_ERROR(audio_clip.audio_format().sample_rate, "Must provide the audio sample rate in audio data.");
-		auto packet = create_matrix(audio_clip.buffer(), true);
+		auto packet = create_matrix_from_blocks(audio_clip.segments(), true);
+		return _classify(output_list, std::move(*std::move(packet)), *audio_clip.audio_format().sample_rate);
+	}
 
+	absl::Status AudioClassifier::_classify(std::vector<std::shared_ptr<AudioClassifierResult>>& output_list, Packet&& audio_packet, double sample_rate) {
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_audio_clip({
-			{ _AUDIO_IN_STREAM_NAME, std::move(*std::move(packet)) },
-			{ _SAMPLE_RATE_IN_STREAM_NAME, std::move(MakePacket<double>(*audio_clip.audio_format().sample_rate)) },
+			{ _AUDIO_IN_STREAM_NAME, std::move(audio_packet) },
+			{ _SAMPLE_RATE_IN_STREAM_NAME, std::move(MakePacket<double>(sample_rate)) },
 			}));
+		return _build_results(output_list, output_packets);
+	}
 
+	absl::Status AudioClassifier::_build_results(std::vector<std::shared_ptr<AudioClassifierResult>>& output_list, const PacketMap& output_packets) {
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& classification_result_proto_list, std::vector<ClassificationResult>, output_packets.at(_TIMESTAMPED_CLASSIFICATIONS_STREAM_NAME));
 		for (const auto& classification_result_proto : classification_result_proto_list) {
-			output_list.push_back(AudioClassifierResult::create_from_pb2(classification_result_proto));
+			if (_label_tables) {
+				output_list.push_back(AudioClassifierResult::create_from_pb2(classification_result_proto, *_label_tables));
+			}
+			else {
+				output_list.push_back(AudioClassifierResult::create_from_pb2(classification_result_proto));
+			}
+		}
+
+		return absl::OkStatus();
+	}
+
+	absl::Status AudioClassifier::classify_batch(
+		std::vector<std::vector<std::shared_ptr<AudioClassifierResult>>>& output_lists,
+		const std::vector<std::shared_ptr<AudioData>>& audio_clips,
+		int num_workers
+	) {
+		std::vector<PacketMap> inputs;
+		inputs.reserve(audio_clips.size());
+		for (const auto& audio_clip : audio_clips) {
+			MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(audio_clip), "audio clip cannot be None");
+			MP_ASSERT_RETURN_IF_ERROR(audio_clip->audio_format().sample_rate, "Must provide the audio sample rate in audio data.");
+			inputs.push_back({
+				{ _AUDIO_IN_STREAM_NAME, std::move(*create_matrix_from_blocks(audio_clip->segments(), true)) },
+				{ _SAMPLE_RATE_IN_STREAM_NAME, std::move(MakePacket<double>(*audio_clip->audio_format().sample_rate)) },
+				});
+		}
+
+		MP_ASSIGN_OR_RETURN(auto outputs, _process_audio_clips(std::move(inputs), num_workers));
+
+		output_lists.clear();
+		output_lists.resize(outputs.size());
+		for (size_t i = 0; i < outputs.size(); i++) {
+			MP_RETURN_IF_ERROR(_build_results(output_lists[i], outputs[i]));
+		}
+
+		return absl::OkStatus();
+	}
+
+	absl::Status AudioClassifier::classify_file(
+		std::vector<std::shared_ptr<AudioClassifierResult>>& output_list,
+		AudioFileReader& reader,
+		int block_length
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(block_length > 0, "block_length must be greater than 0");
+
+		const auto sample_rate = *reader.audio_format().sample_rate;
+		const auto start = reader.position();
+
+		// only one block is converted at a time, straight into the matrix of its packet
+		while (true) {
+			const auto offset_ms = static_cast<int64_t>((reader.position() - start) * 1000 / sample_rate);
+
+			auto matrix = reader.ReadMatrix(block_length);
+			if (!matrix) {
+				break;
+			}
+
+			const auto begin = output_list.size();
+			MP_RETURN_IF_ERROR(_classify(output_list, std::move(*create_matrix(std::move(*matrix))), sample_rate));
+			for (auto i = begin; i < output_list.size(); i++) {
+				output_list[i]->timestamp_ms += offset_ms;
+			}
 		}
+
+		return absl::OkStatus();
 	}
 
 	absl::Status AudioClassifier::classify_async(const AudioData& audio_block, int64_t timestamp_ms) {
@@ -146,7 +236,7 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 			);
 		}
 
-		auto packet = create_matrix(audio_block.buffer(), true);
+		auto packet = create_matrix_from_blocks(audio_block.segments(), true);
 
 		return _send_audio_stream_data({
 			{ _AUDIO_IN_STREAM_NAME, std::move(std::move(packet)->At(Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND))) }
@@ -7,6 +7,7 @@
 #include "binding/tasks/audio/core/audio_task_running_mode.h"
 #include "binding/tasks/audio/core/base_audio_task_api.h"
 #include "binding/tasks/components/containers/audio_data.h"
+#include "binding/tasks/components/containers/audio_file_reader.h"
 #include "binding/tasks/components/containers/classification_result.h"
 #include "binding/tasks/core/base_options.h"
 #include "binding/tasks/core/task_info.h"
@@ -28,7 +29,8 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 			const std::optional<float>& score_threshold = std::nullopt,
 			const std::vector<std::string>& category_allowlist = std::vector<std::string>(),
 			const std::vector<std::string>& category_denylist = std::vector<std::string>(),
-			AudioClassifierResultCallback result_callback = nullptr
+			AudioClassifierResultCallback result_callback = nullptr,
+			bool output_compact_categories = false
 		)
 			:
 			base_options(base_options),
@@ -38,7 +40,8 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 			score_threshold(score_threshold),
 			category_allowlist(category_allowlist),
 			category_denylist(category_denylist),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			output_compact_categories(output_compact_categories)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::audio::audio_classifier::proto::AudioClassifierGraphOptions>> to_pb2() const;
@@ -51,6 +54,8 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 		CV_PROP_RW std::vector<std::string> category_allowlist;
 		CV_PROP_RW std::vector<std::string> category_denylist;
 		CV_PROP_W  AudioClassifierResultCallback result_callback;
+		// Each head returns its scores as a matrix with a shared label table in compact instead of category objects
+		CV_PROP_RW bool output_compact_categories;
 	};
 
 	class CV_EXPORTS_W AudioClassifier : public ::mediapipe::tasks::lua::audio::core::base_audio_task_api::BaseAudioTaskApi {
@@ -60,11 +65,37 @@ namespace mediapipe::tasks::lua::audio::audio_classifier {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioClassifier>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::audio_task_running_mode::AudioTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioClassifier>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioClassifier>> create_from_options(std::shared_ptr<AudioClassifierOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_audio_task_api::AudioTaskFuture> create_from_options_async(std::shared_ptr<AudioClassifierOptions> options);
 		CV_WRAP [[nodiscard]] absl::Status classify(CV_OUT std::vector<std::shared_ptr<AudioClassifierResult>>& output_list, const components::containers::audio_data::AudioData& audio_clip);
+		/**
+		 * Runs classify on every clip of audio_clips, concurrently on num_workers instances of the graph,
+		 * 4 or the number of hardware threads if lower when num_workers is 0, and returns the results of each clip in input order.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status classify_batch(
+			CV_OUT std::vector<std::vector<std::shared_ptr<AudioClassifierResult>>>& output_lists,
+			const std::vector<std::shared_ptr<components::containers::audio_data::AudioData>>& audio_clips,
+			int num_workers = 0
+		);
+		/**
+		 * Runs classify on the blocks of block_length frames read from the current position of reader to the end of the file,
+		 * with result timestamps relative to that position.
+		 * block_length should be a multiple of the model input length to get the results of a single classify call on the whole file.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status classify_file(
+			CV_OUT std::vector<std::shared_ptr<AudioClassifierResult>>& output_list,
+			components::containers::audio_file_reader::AudioFileReader& reader,
+			int block_length
+		);
 		CV_WRAP [[nodiscard]] absl::Status classify_async(const components::containers::audio_data::AudioData& audio_block, int64_t timestamp_ms);
+	private:
+		// Runs the clip graph on an audio matrix packet
+		[[nodiscard]] absl::Status _classify(std::vector<std::shared_ptr<AudioClassifierResult>>& output_list, Packet&& audio_packet, double sample_rate);
+		[[nodiscard]] absl::Status _build_results(std::vector<std::shared_ptr<AudioClassifierResult>>& output_list, const std::map<std::string, Packet>& output_packets);
+		std::shared_ptr<components::containers::category::LabelTableCache> _label_tables;
 	};
 }
@@ -7,6 +7,7 @@
 #include "binding/tasks/audio/core/audio_task_running_mode.h"
 #include "binding/tasks/audio/core/base_audio_task_api.h"
 #include "binding/tasks/components/containers/audio_data.h"
+#include "binding/tasks/components/containers/audio_file_reader.h"
 #include "binding/tasks/components/containers/embedding_result.h"
 #include "binding/tasks/components/utils/cosine_similarity.h"
 #include "binding/tasks/core/base_options.h"
@@ -52,12 +53,37 @@ namespace mediapipe::tasks::lua::audio::audio_embedder {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioEmbedder>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::audio_task_running_mode::AudioTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioEmbedder>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioEmbedder>> create_from_options(std::shared_ptr<AudioEmbedderOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_audio_task_api::AudioTaskFuture> create_from_options_async(std::shared_ptr<AudioEmbedderOptions> options);
 		CV_WRAP [[nodiscard]] absl::Status embed(CV_OUT std::vector<std::shared_ptr<AudioEmbedderResult>>& output_list, const components::containers::audio_data::AudioData& audio_clip);
+		/**
+		 * Runs embed on every clip of audio_clips, concurrently on num_workers instances of the graph,
+		 * 4 or the number of hardware threads if lower when num_workers is 0, and returns the results of each clip in input order.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status embed_batch(
+			CV_OUT std::vector<std::vector<std::shared_ptr<AudioEmbedderResult>>>& output_lists,
+			const std::vector<std::shared_ptr<components::containers::audio_data::AudioData>>& audio_clips,
+			int num_workers = 0
+		);
+		/**
+		 * Runs embed on the blocks of block_length frames read from the current position of reader to the end of the file,
+		 * with result timestamps relative to that position.
+		 * block_length should be a multiple of the model input length to get the results of a single embed call on the whole file.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status embed_file(
+			CV_OUT std::vector<std::shared_ptr<AudioEmbedderResult>>& output_list,
+			components::containers::audio_file_reader::AudioFileReader& reader,
+			int block_length
+		);
 		CV_WRAP [[nodiscard]] absl::Status embed_async(const components::containers::audio_data::AudioData& audio_block, int64_t timestamp_ms);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<float> cosine_similarity(const components::containers::embedding_result::Embedding& u, const components::containers::embedding_result::Embedding& v);
+	private:
+		// Runs the clip graph on an audio matrix packet
+		[[nodiscard]] absl::Status _embed(std::vector<std::shared_ptr<AudioEmbedderResult>>& output_list, Packet&& audio_packet, double sample_rate);
+		[[nodiscard]] absl::Status _build_results(std::vector<std::shared_ptr<AudioEmbedderResult>>& output_list, const std::map<std::string, Packet>& output_packets);
 	};
 }
@@ -1,5 +1,11 @@
+#include "mediapipe/framework/formats/matrix.h"
+#include "mediapipe/framework/tool/validate_name.h"
 #include "binding/tasks/audio/core/base_audio_task_api.h"
 
+namespace {
+	constexpr double _WARMUP_SAMPLE_RATE = 16000;
+}
+
 namespace mediapipe::tasks::lua::audio::core::base_audio_task_api {
 	using audio_task_running_mode::AudioTaskRunningMode;
 	using audio_task_running_mode::AudioTaskRunningModeToChar;
@@ -15,9 +21,10 @@ namespace mediapipe::tasks::lua::audio::core::base_audio_task_api {
 	absl::StatusOr<std::shared_ptr<BaseAudioTaskApi>> BaseAudioTaskApi::create(
 		const CalculatorGraphConfig& graph_config,
 		audio_task_running_mode::AudioTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
-		return BaseAudioTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<BaseAudioTaskApi*>(nullptr));
+		return BaseAudioTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<BaseAudioTaskApi*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::map<std::string, Packet>> BaseAudioTaskApi::_process_audio_clip(const std::map<std::string, Packet>& inputs) {
@@ -27,6 +34,26 @@ namespace mediapipe::tasks::lua::audio::core::base_audio_task_api {
 		return _runner->Process(inputs);
 	}
 
+	absl::StatusOr<std::vector<std::map<std::string, Packet>>> BaseAudioTaskApi::_process_audio_clips(
+		std::vector<std::map<std::string, Packet>>&& inputs,
+		int num_workers
+	) {
+		using PacketMap = std::map<std::string, Packet>;
+
+		MP_ASSERT_RETURN_IF_ERROR(_running_mode == AudioTaskRunningMode::AUDIO_CLIPS,
+			"Task is not initialized with the audio clips mode. Current running mode: "
+			<< StringifyAudioTaskRunningMode(_running_mode));
+
+		return mediapipe::tasks::lua::core::batch_pool::ProcessBatch<BaseAudioTaskApi, PacketMap, PacketMap>(*this, _batch_pool, std::move(inputs), num_workers,
+			[this]() {
+				return create(_runner->GetGraphConfig(), AudioTaskRunningMode::AUDIO_CLIPS, nullptr, _executor);
+			},
+			[](BaseAudioTaskApi& task, PacketMap&& clip_inputs) {
+				return task._process_audio_clip(clip_inputs);
+			}
+		);
+	}
+
 	absl::Status BaseAudioTaskApi::_set_sample_rate(const std::string& sample_rate_stream_name, float sample_rate) {
 		MP_ASSERT_RETURN_IF_ERROR(_running_mode == AudioTaskRunningMode::AUDIO_STREAM,
 			"Task is not initialized with the audio stream mode. Current running mode: "
@@ -43,7 +70,44 @@ namespace mediapipe::tasks::lua::audio::core::base_audio_task_api {
 		return _runner->Send(inputs);
 	}
 
+	absl::Status BaseAudioTaskApi::warmup(int num_clips) {
+		if (num_clips <= 0 || _running_mode == AudioTaskRunningMode::AUDIO_STREAM) {
+			return absl::OkStatus();
+		}
+
+		std::map<std::string, Packet> inputs;
+		for (const auto& input_stream : _runner->GetGraphConfig().input_stream()) {
+			std::string tag;
+			std::string name;
+			MP_RETURN_IF_ERROR(mediapipe::tool::ParseTagAndName(input_stream, &tag, &name));
+
+			if (tag == "AUDIO") {
+				inputs[name] = mediapipe::MakePacket<mediapipe::Matrix>(mediapipe::Matrix::Zero(1, static_cast<int>(_WARMUP_SAMPLE_RATE)));
+			}
+			else if (tag == "SAMPLE_RATE") {
+				inputs[name] = mediapipe::MakePacket<double>(_WARMUP_SAMPLE_RATE);
+			}
+			else {
+				return absl::OkStatus();
+			}
+		}
+
+		for (int i = 0; i < num_clips; i++) {
+			MP_RETURN_IF_ERROR(_runner->Process(inputs).status());
+		}
+
+		return absl::OkStatus();
+	}
+
 	absl::Status BaseAudioTaskApi::close() {
 		return _runner->Close();
 	}
+
+	bool AudioTaskFuture::ready() const {
+		return m_future.ready();
+	}
+
+	absl::StatusOr<std::shared_ptr<BaseAudioTaskApi>> AudioTaskFuture::get() {
+		return m_future.get();
+	}
 }
@@ -4,8 +4,11 @@
 
 #include "mediapipe/framework/calculator.pb.h"
 #include "mediapipe/framework/port/status_macros.h"
+#include "binding/instance_pool.h"
 #include "binding/packet.h"
 #include "binding/tasks/audio/core/audio_task_running_mode.h"
+#include "binding/tasks/core/batch_pool.h"
+#include "binding/tasks/core/task_future.h"
 #include "binding/tasks/core/task_runner.h"
 #include "binding/timestamp.h"
 
@@ -19,7 +22,8 @@ namespace mediapipe::tasks::lua::audio::core::base_audio_task_api {
 			const CalculatorGraphConfig& graph_config,
 			audio_task_running_mode::AudioTaskRunningMode running_mode,
 			mediapipe::lua::PacketsCallback&& packet_callback,
-			_Tp*
+			_Tp*,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		) {
 			if (running_mode == audio_task_running_mode::AudioTaskRunningMode::AUDIO_STREAM) {
 				MP_ASSERT_RETURN_IF_ERROR(packet_callback, "The audio task is in audio stream mode, a user-defined result "
@@ -30,8 +34,10 @@ namespace mediapipe::tasks::lua::audio::core::base_audio_task_api {
 					"callback should not be provided.");
 			}
 
-			MP_ASSIGN_OR_RETURN(auto runner, mediapipe::lua::task_runner::create(graph_config, std::move(packet_callback)));
-			return std::make_shared<_Tp>(runner, running_mode);
+			MP_ASSIGN_OR_RETURN(auto runner, mediapipe::lua::task_runner::create(graph_config, std::move(packet_callback), executor));
+			auto task = std::make_shared<_Tp>(runner, running_mode);
+			task->_executor = executor;
+			return task;
 		}
 
 		BaseAudioTaskApi(
@@ -42,15 +48,50 @@ namespace mediapipe::tasks::lua::audio::core::base_audio_task_api {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<BaseAudioTaskApi>> create(
 			const CalculatorGraphConfig& graph_config,
 			audio_task_running_mode::AudioTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::map<std::string, Packet>> _process_audio_clip(const std::map<std::string, Packet>& inputs);
 		CV_WRAP [[nodiscard]] absl::Status _set_sample_rate(const std::string& sample_rate_stream_name, float sample_rate);
 		CV_WRAP [[nodiscard]] absl::Status _send_audio_stream_data(const std::map<std::string, Packet>& inputs);
+		/**
+		 * Runs num_clips silent one second clips through the task, so that tensor allocation and weight packing
+		 * happen before the first real clip. Audio stream tasks are not warmed up.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status warmup(int num_clips = 1);
 		CV_WRAP [[nodiscard]] absl::Status close();
 	protected:
+		// Processes the clips of inputs with batch_pool::ProcessBatch, on instances of the graph of the task created on its executor
+		[[nodiscard]] absl::StatusOr<std::vector<std::map<std::string, Packet>>> _process_audio_clips(
+			std::vector<std::map<std::string, Packet>>&& inputs,
+			int num_workers
+		);
+
 		std::shared_ptr<mediapipe::tasks::core::TaskRunner> _runner;
 		audio_task_running_mode::AudioTaskRunningMode _running_mode;
 		std::optional<float> _default_sample_rate;
+		// the executor the task was created with, shared by its batch instances
+		std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor> _executor;
+		std::unique_ptr<mediapipe::lua::instance_pool::InstancePool<BaseAudioTaskApi, std::map<std::string, Packet>, std::map<std::string, Packet>>> _batch_pool;
+	};
+
+	// An audio task being created in the background by create_from_options_async
+	class CV_EXPORTS_W AudioTaskFuture {
+	public:
+		template<typename _Options, typename _Tp>
+		AudioTaskFuture(
+			const std::shared_ptr<_Options>& options,
+			absl::StatusOr<std::shared_ptr<_Tp>>(*create_from_options)(std::shared_ptr<_Options>)
+		) : m_future([options, create_from_options]() -> absl::StatusOr<std::shared_ptr<BaseAudioTaskApi>> {
+			return create_from_options(options);
+		}, options) {}
+
+		// Whether get returns without waiting
+		CV_WRAP bool ready() const;
+
+		// Waits for the task to be created and returns it
+		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<BaseAudioTaskApi>> get();
+	private:
+		mediapipe::tasks::lua::core::task_future::TaskFuture<BaseAudioTaskApi> m_future;
 	};
 }
@@ -1,4 +1,5 @@
 #include "binding/tasks/components/containers/audio_data.h"
+#include <opencv2/core.hpp>
 
 namespace mediapipe::tasks::lua::components::containers::audio_data {
 	absl::Status AudioData::load_from_mat(cv::Mat src, int offset, int size) {
@@ -27,25 +28,49 @@ namespace mediapipe::tasks::lua::components::containers::audio_data {
 			"Index out of range. offset " << offset << " + size " << size <<
 			" should be <= src's length: " << src.rows);
 
+		if (size == 0) {
+			return absl::OkStatus();
+		}
+
 		if (size >= _buffer.rows) {
 			// If the internal buffer is shorter than the load target (src), copy
 			// values from the end of the src array to the internal buffer.
 			int new_size = _buffer.rows;
-			int new_offset = src.rows - new_size;
+			int new_offset = offset + size - new_size;
 			cv::Mat(src, cv::Rect(0, new_offset, 1, new_size)).copyTo(_buffer);
+			_head = 0;
+			return absl::OkStatus();
 		}
-		else {
-			// Shift the internal buffer backward.
-			auto remaining_size = _buffer.rows - size;
-			auto begining = cv::Mat(_buffer, cv::Rect(0, 0, 1, remaining_size));
-			auto ending = cv::Mat(_buffer, cv::Rect(0, size, 1, remaining_size));
-			ending.copyTo(begining);
-
-			// add the incoming data to the end of the buffer
-			auto incoming = cv::Mat(src, cv::Rect(0, offset, 1, size));
-			auto dst = cv::Mat(_buffer, cv::Rect(0, remaining_size, 1, size));
-			incoming.copyTo(dst);
+
+		// Overwrite the oldest samples, wrapping around the end of the buffer.
+		int first_size = std::min(size, _buffer.rows - _head);
+		auto dst = cv::Mat(_buffer, cv::Rect(0, _head, 1, first_size));
+		cv::Mat(src, cv::Rect(0, offset, 1, first_size)).copyTo(dst);
+
+		if (first_size < size) {
+			dst = cv::Mat(_buffer, cv::Rect(0, 0, 1, size - first_size));
+			cv::Mat(src, cv::Rect(0, offset + first_size, 1, size - first_size)).copyTo(dst);
 		}
+
+		_head = (_head + size) % _buffer.rows;
+		return absl::OkStatus();
+	}
+
+	const cv::Mat AudioData::buffer() const {
+		if (_head == 0) {
+			return _buffer;
+		}
+
+		cv::Mat ordered;
+		cv::vconcat(segments(), ordered);
+		return ordered;
+	}
+
+	std::vector<cv::Mat> AudioData::segments() const {
+		return {
+			_buffer.rowRange(_head, _buffer.rows),
+			_buffer.rowRange(0, _head),
+		};
 	}
 
 	absl::StatusOr<std::shared_ptr<AudioData>> AudioData::create_from_mat(cv::Mat src, const std::optional<float>& sample_rate) {
@@ -53,8 +78,4 @@ namespace mediapipe::tasks::lua::components::containers::audio_data {
 		MP_RETURN_IF_ERROR(obj->load_from_mat(src));
 		return obj;
 	}
-
-	// cv::Mat read_wav_file(const std::string filename, int channels) {
-	// 	// TODO
-	// }
 }
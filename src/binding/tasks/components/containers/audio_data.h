@@ -35,6 +35,7 @@ namespace mediapipe::tasks::lua::components::containers::audio_data {
 
 		CV_WRAP void clear() {
 			_buffer.setTo(0.0);
+			_head = 0;
 		}
 
 		CV_WRAP [[nodiscard]] absl::Status load_from_mat(cv::Mat src, int offset = 0, int size = -1);
@@ -48,13 +49,17 @@ namespace mediapipe::tasks::lua::components::containers::audio_data {
 			return _buffer.size[0];
 		}
 
-		CV_WRAP_AS(get buffer) const cv::Mat buffer()const {
-			return _buffer;
-		}
+		// Samples from the oldest to the newest.
+		// Once a load wrapped around the end of the storage, it is a copy, writing to it does not change the audio data.
+		CV_WRAP_AS(get buffer) const cv::Mat buffer() const;
+
+		// Views of the storage holding the oldest then the newest samples, the second one is empty when nothing wrapped around
+		CV_WRAP std::vector<cv::Mat> segments() const;
 	private:
 		AudioDataFormat _audio_format;
+		// ring buffer, loaded chunks overwrite the oldest samples
 		cv::Mat _buffer;
+		// index of the oldest sample in _buffer
+		int _head = 0;
 	};
-
-	// CV_EXPORTS_W cv::Mat read_wav_file(const std::string filename, int channels = 1);
 }
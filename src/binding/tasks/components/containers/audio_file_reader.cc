@@ -0,0 +1,209 @@
+#include "mediapipe/framework/port/status_macros.h"
+#include "binding/tasks/components/containers/audio_file_reader.h"
+#include "binding/util.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+	using namespace mediapipe::tasks::lua::components::containers::audio_file_reader;
+
+	constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+	constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+	constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+	template<typename _Tp>
+	_Tp ReadLittleEndian(const char* data) {
+		_Tp value;
+		std::memcpy(&value, data, sizeof(_Tp));
+		return value;
+	}
+
+	size_t GetSampleSize(AudioFileReader::SampleFormat sample_format) {
+		return sample_format == AudioFileReader::SampleFormat::PCM16 ? 2 : 4;
+	}
+}
+
+namespace mediapipe::tasks::lua::components::containers::audio_file_reader {
+	using audio_data::AudioData;
+	using audio_data::AudioDataFormat;
+	using mediapipe::lua::model_asset_registry::ModelAsset;
+
+	AudioFileReader::AudioFileReader(
+		std::shared_ptr<const ModelAsset> mapping,
+		size_t data_offset,
+		size_t data_size,
+		SampleFormat sample_format,
+		int num_channels,
+		float sample_rate
+	) :
+		m_mapping(std::move(mapping)),
+		m_sample_format(sample_format),
+		m_audio_format(num_channels, sample_rate),
+		m_frame_size(GetSampleSize(sample_format) * num_channels)
+	{
+		m_data = static_cast<const char*>(m_mapping->data()) + data_offset;
+		m_num_frames = data_size / m_frame_size;
+	}
+
+	absl::StatusOr<std::shared_ptr<AudioFileReader>> AudioFileReader::open_wav(const std::string& path) {
+		MP_ASSIGN_OR_RETURN(auto mapping, mediapipe::lua::model_asset_registry::MapFile(path));
+
+		const auto* data = static_cast<const char*>(mapping->data());
+		const auto size = mapping->size();
+
+		MP_ASSERT_RETURN_IF_ERROR(size >= 12 && std::memcmp(data, "RIFF", 4) == 0 && std::memcmp(data + 8, "WAVE", 4) == 0,
+			path << " is not a RIFF WAVE file");
+
+		uint16_t format_tag = 0;
+		int num_channels = 0;
+		uint32_t sample_rate = 0;
+		uint16_t bits_per_sample = 0;
+		size_t data_offset = 0;
+		size_t data_size = 0;
+
+		for (size_t offset = 12; offset + 8 <= size;) {
+			const auto chunk_size = static_cast<size_t>(ReadLittleEndian<uint32_t>(data + offset + 4));
+			const auto* chunk = data + offset + 8;
+			const auto available = size - offset - 8;
+
+			if (std::memcmp(data + offset, "fmt ", 4) == 0) {
+				MP_ASSERT_RETURN_IF_ERROR(chunk_size >= 16 && available >= 16, path << " has a truncated fmt chunk");
+				format_tag = ReadLittleEndian<uint16_t>(chunk);
+				num_channels = ReadLittleEndian<uint16_t>(chunk + 2);
+				sample_rate = ReadLittleEndian<uint32_t>(chunk + 4);
+				bits_per_sample = ReadLittleEndian<uint16_t>(chunk + 14);
+
+				if (format_tag == WAVE_FORMAT_EXTENSIBLE) {
+					MP_ASSERT_RETURN_IF_ERROR(chunk_size >= 26 && available >= 26, path << " has a truncated fmt chunk");
+					// the sub format GUID starts with the format tag
+					format_tag = ReadLittleEndian<uint16_t>(chunk + 24);
+				}
+			}
+			else if (std::memcmp(data + offset, "data", 4) == 0) {
+				data_offset = offset + 8;
+				// streaming writers leave the size of the data chunk unset
+				data_size = chunk_size == 0 ? available : std::min(chunk_size, available);
+				break;
+			}
+
+			// chunks are padded to an even size
+			offset += 8 + chunk_size + (chunk_size & 1);
+		}
+
+		MP_ASSERT_RETURN_IF_ERROR(format_tag != 0, path << " has no fmt chunk");
+		MP_ASSERT_RETURN_IF_ERROR(data_offset != 0, path << " has no data chunk");
+
+		SampleFormat sample_format = SampleFormat::PCM16;
+		if (format_tag == WAVE_FORMAT_PCM && bits_per_sample == 16) {
+			sample_format = SampleFormat::PCM16;
+		}
+		else if (format_tag == WAVE_FORMAT_PCM && bits_per_sample == 32) {
+			sample_format = SampleFormat::PCM32;
+		}
+		else if (format_tag == WAVE_FORMAT_IEEE_FLOAT && bits_per_sample == 32) {
+			sample_format = SampleFormat::FLOAT32;
+		}
+		else {
+			MP_ASSERT_RETURN_IF_ERROR(false, path << " has an unsupported sample format " << format_tag << " with " << bits_per_sample
+				<< " bits per sample. Supported formats are 16 and 32 bits PCM, and 32 bits float.");
+		}
+
+		MP_ASSERT_RETURN_IF_ERROR(num_channels > 0 && num_channels <= CV_CN_MAX, path << " has an unsupported number of channels " << num_channels);
+		MP_ASSERT_RETURN_IF_ERROR(sample_rate > 0, path << " has no sample rate");
+
+		return std::make_shared<AudioFileReader>(mapping, data_offset, data_size, sample_format, num_channels, static_cast<float>(sample_rate));
+	}
+
+	absl::StatusOr<std::shared_ptr<AudioFileReader>> AudioFileReader::open_pcm(
+		const std::string& path,
+		SampleFormat sample_format,
+		int num_channels,
+		float sample_rate
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(num_channels > 0 && num_channels <= CV_CN_MAX, "num_channels must be in [1, " << CV_CN_MAX << "]");
+		MP_ASSERT_RETURN_IF_ERROR(sample_rate > 0, "sample_rate must be greater than 0");
+
+		MP_ASSIGN_OR_RETURN(auto mapping, mediapipe::lua::model_asset_registry::MapFile(path));
+		const auto size = mapping->size();
+		return std::make_shared<AudioFileReader>(mapping, 0, size, sample_format, num_channels, sample_rate);
+	}
+
+	absl::Status AudioFileReader::seek(int64_t frame) {
+		MP_ASSERT_RETURN_IF_ERROR(frame >= 0 && frame <= m_num_frames, "Frame " << frame << " is out of [0, " << m_num_frames << "]");
+		m_position = frame;
+		return absl::OkStatus();
+	}
+
+	absl::StatusOr<std::shared_ptr<AudioData>> AudioFileReader::read(int num_frames) {
+		MP_ASSERT_RETURN_IF_ERROR(num_frames > 0, "num_frames must be greater than 0");
+
+		cv::Mat samples;
+		const auto frames = ReadSamples(num_frames, samples);
+		if (frames == 0) {
+			return std::shared_ptr<AudioData>();
+		}
+
+		auto audio_block = std::make_shared<AudioData>(frames, m_audio_format);
+		MP_RETURN_IF_ERROR(audio_block->load_from_mat(samples));
+		return audio_block;
+	}
+
+	absl::StatusOr<int> AudioFileReader::read_into(AudioData& audio_block, int num_frames) {
+		MP_ASSERT_RETURN_IF_ERROR(num_frames > 0, "num_frames must be greater than 0");
+		MP_ASSERT_RETURN_IF_ERROR(audio_block.audio_format().num_channels == m_audio_format.num_channels,
+			"The audio data has " << audio_block.audio_format().num_channels << " channels, but the file has " << m_audio_format.num_channels << ".");
+
+		const auto frames = ReadSamples(num_frames, m_samples);
+		if (frames != 0) {
+			MP_RETURN_IF_ERROR(audio_block.load_from_mat(m_samples.rowRange(0, frames)));
+		}
+		return frames;
+	}
+
+	std::unique_ptr<mediapipe::Matrix> AudioFileReader::ReadMatrix(int num_frames) {
+		static_assert(!(mediapipe::Matrix::Flags & Eigen::RowMajorBit), "audio matrices are expected to be column-major");
+
+		const int frames = static_cast<int>(std::min<int64_t>(num_frames, m_num_frames - m_position));
+		if (frames <= 0) {
+			return nullptr;
+		}
+
+		// the columns of a column-major matrix hold the interleaved samples of a frame
+		auto matrix = std::make_unique<mediapipe::Matrix>(m_audio_format.num_channels, frames);
+		cv::Mat samples(frames, 1, CV_MAKETYPE(CV_32F, m_audio_format.num_channels), matrix->data());
+		ReadSamples(frames, samples);
+		return matrix;
+	}
+
+	int AudioFileReader::ReadSamples(int num_frames, cv::Mat& samples) {
+		const int frames = static_cast<int>(std::min<int64_t>(num_frames, m_num_frames - m_position));
+		if (frames <= 0) {
+			return 0;
+		}
+
+		const int num_channels = m_audio_format.num_channels;
+		const void* src_data = m_data + m_position * m_frame_size;
+
+		// the buffer of read_into is reused as long as it is large enough
+		if (samples.rows < frames || samples.type() != CV_MAKETYPE(CV_32F, num_channels)) {
+			samples.create(frames, 1, CV_MAKETYPE(CV_32F, num_channels));
+		}
+		cv::Mat dst = samples.rowRange(0, frames);
+
+		// convertTo is vectorized, the mapping is only read
+		switch (m_sample_format) {
+		case SampleFormat::PCM16:
+			cv::Mat(frames, 1, CV_MAKETYPE(CV_16S, num_channels), const_cast<void*>(src_data)).convertTo(dst, dst.type(), 1.0 / 32768);
+			break;
+		case SampleFormat::PCM32:
+			cv::Mat(frames, 1, CV_MAKETYPE(CV_32S, num_channels), const_cast<void*>(src_data)).convertTo(dst, dst.type(), 1.0 / 2147483648.0);
+			break;
+		case SampleFormat::FLOAT32:
+			cv::Mat(frames, 1, CV_MAKETYPE(CV_32F, num_channels), const_cast<void*>(src_data)).copyTo(dst);
+			break;
+		}
+
+		m_position += frames;
+		return frames;
+	}
+}
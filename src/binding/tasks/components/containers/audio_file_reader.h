@@ -0,0 +1,92 @@
+#pragma once
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/formats/matrix.h"
+#include "binding/model_asset_registry.h"
+#include "binding/tasks/components/containers/audio_data.h"
+#include <opencv2/core/mat.hpp>
+
+namespace mediapipe::tasks::lua::components::containers::audio_file_reader {
+	/**
+	 * Reads a WAV or a raw PCM file block by block.
+	 * The file is mapped in memory and only the requested frames are converted to float samples,
+	 * so that long recordings are processed in bounded memory.
+	 * Samples are expected in little endian.
+	 */
+	class CV_EXPORTS_W AudioFileReader {
+	public:
+		enum class SampleFormat {
+			// 16-bit signed integers
+			PCM16 = 0,
+			// 32-bit signed integers
+			PCM32 = 1,
+			// 32-bit floats
+			FLOAT32 = 2,
+		};
+
+		AudioFileReader(
+			std::shared_ptr<const mediapipe::lua::model_asset_registry::ModelAsset> mapping,
+			size_t data_offset,
+			size_t data_size,
+			SampleFormat sample_format,
+			int num_channels,
+			float sample_rate
+		);
+
+		// Opens a RIFF WAV file holding PCM16, PCM32 or FLOAT32 samples
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioFileReader>> open_wav(const std::string& path);
+
+		// Opens a headerless file of interleaved samples
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<AudioFileReader>> open_pcm(
+			const std::string& path,
+			SampleFormat sample_format,
+			int num_channels,
+			float sample_rate
+		);
+
+		CV_WRAP_AS(get audio_format) const audio_data::AudioDataFormat audio_format() const {
+			return m_audio_format;
+		}
+
+		CV_WRAP_AS(get sample_format) SampleFormat sample_format() const {
+			return m_sample_format;
+		}
+
+		// Number of frames in the file, a frame holding one sample per channel
+		CV_WRAP_AS(get num_frames) int64_t num_frames() const {
+			return m_num_frames;
+		}
+
+		// Index of the next frame to read
+		CV_WRAP_AS(get position) int64_t position() const {
+			return m_position;
+		}
+
+		CV_WRAP [[nodiscard]] absl::Status seek(int64_t frame);
+
+		// Returns the next num_frames frames, fewer at the end of the file, or nothing once the whole file has been read
+		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<audio_data::AudioData>> read(int num_frames);
+
+		// Loads the next num_frames frames, fewer at the end of the file, in audio_block and returns the number of frames loaded
+		CV_WRAP [[nodiscard]] absl::StatusOr<int> read_into(audio_data::AudioData& audio_block, int num_frames);
+
+		// Converts the next num_frames frames, fewer at the end of the file, straight into a (channels x frames) matrix
+		// laid out like audio packets, or returns nothing once the whole file has been read
+		std::unique_ptr<mediapipe::Matrix> ReadMatrix(int num_frames);
+
+	private:
+		// Converts the next num_frames frames, fewer at the end of the file, to a (frames x 1) float matrix with one channel per audio channel
+		int ReadSamples(int num_frames, cv::Mat& samples);
+
+		std::shared_ptr<const mediapipe::lua::model_asset_registry::ModelAsset> m_mapping;
+		const char* m_data;
+		SampleFormat m_sample_format;
+		audio_data::AudioDataFormat m_audio_format;
+		size_t m_frame_size;
+		int64_t m_num_frames;
+		int64_t m_position = 0;
+		// conversion buffer of read_into, reused from one block to the next
+		cv::Mat m_samples;
+	};
+}
@@ -1,4 +1,56 @@
+#include "mediapipe/framework/port/status_macros.h"
+#include "mediapipe/tasks/cc/metadata/metadata_extractor.h"
+#include "mediapipe/util/label_map_util.h"
+#include "binding/model_asset_registry.h"
 #include "binding/tasks/components/containers/category.h"
+#include <cmath>
+#include <limits>
+
+namespace {
+	using mediapipe::tasks::lua::components::containers::category::LabelTable;
+
+	absl::Mutex intern_mutex;
+	std::map<std::string, std::weak_ptr<LabelTable>> interned;
+
+	std::string GetInternKey(const LabelTable& table) {
+		std::string key;
+		for (const auto& name : table.category_names) {
+			key.append(name).push_back('\0');
+		}
+		key.push_back('\1');
+		for (const auto& name : table.display_names) {
+			key.append(name).push_back('\0');
+		}
+		return key;
+	}
+
+	// classifications without an index are indexed by their position
+	size_t GetIndex(const google::protobuf::RepeatedPtrField<mediapipe::Classification>& list, int i) {
+		return list[i].has_index() && list[i].index() >= 0 ? list[i].index() : i;
+	}
+
+	std::shared_ptr<LabelTable> Intern(LabelTable&& table) {
+		auto key = GetInternKey(table);
+
+		absl::MutexLock lock(&intern_mutex);
+
+		auto found = interned.find(key);
+		if (found != interned.end()) {
+			auto shared = found->second.lock();
+			if (shared) {
+				return shared;
+			}
+		}
+
+		for (auto it = interned.begin(); it != interned.end();) {
+			it = it->second.expired() ? interned.erase(it) : std::next(it);
+		}
+
+		auto shared = std::make_shared<LabelTable>(std::move(table));
+		interned[std::move(key)] = shared;
+		return shared;
+	}
+}
 
 namespace mediapipe::tasks::lua::components::containers::category {
 	std::shared_ptr<Classification> Category::to_pb2() const {
@@ -18,4 +70,148 @@ namespace mediapipe::tasks::lua::components::containers::category {
 			pb2_obj.label()
 		);
 	}
-}
\ No newline at end of file
+
+	std::shared_ptr<ClassificationList> CompactCategories::to_pb2() const {
+		auto pb2_obj = std::make_shared<ClassificationList>();
+		if (scores.empty()) {
+			return pb2_obj;
+		}
+
+		const auto* score = scores.ptr<float>();
+		for (size_t index = 0; index < scores.total(); index++) {
+			if (std::isnan(score[index])) {
+				continue;
+			}
+
+			auto* classification = pb2_obj->add_classification();
+			classification->set_index(index);
+			classification->set_score(score[index]);
+			if (labels && index < labels->category_names.size()) {
+				classification->set_label(labels->category_names[index]);
+				classification->set_display_name(labels->display_names[index]);
+			}
+		}
+		return pb2_obj;
+	}
+
+	absl::StatusOr<std::shared_ptr<LabelTableCache>> LabelTableCache::CreateFromModel(
+		const std::string& model_asset_path,
+		const std::string& model_asset_buffer,
+		const std::string& display_names_locale
+	) {
+		using mediapipe::tasks::metadata::ModelMetadataExtractor;
+
+		std::shared_ptr<const mediapipe::lua::model_asset_registry::ModelAsset> model_asset;
+		const char* model_data = model_asset_buffer.data();
+		size_t model_size = model_asset_buffer.size();
+		if (model_asset_buffer.empty()) {
+			MP_ASSIGN_OR_RETURN(model_asset, mediapipe::lua::model_asset_registry::Acquire(model_asset_path));
+			model_data = static_cast<const char*>(model_asset->data());
+			model_size = model_asset->size();
+		}
+
+		MP_ASSIGN_OR_RETURN(auto extractor, ModelMetadataExtractor::CreateFromModelBuffer(model_data, model_size));
+		const auto* subgraphs = extractor->GetModel()->subgraphs();
+		MP_ASSERT_RETURN_IF_ERROR(subgraphs && subgraphs->size() > 0, "The model has no subgraph");
+		const auto* subgraph = subgraphs->Get(0);
+		const auto* tensor_metadata_list = extractor->GetOutputTensorMetadata();
+
+		auto label_tables = std::make_shared<LabelTableCache>();
+		for (flatbuffers::uoffset_t head_index = 0; subgraph->outputs() && head_index < subgraph->outputs()->size(); head_index++) {
+			// one category per score of the last dimension of the output tensor
+			const auto* shape = subgraph->tensors()->Get(subgraph->outputs()->Get(head_index))->shape();
+			if (!shape || shape->size() == 0) {
+				continue;
+			}
+			const auto num_categories = static_cast<size_t>(std::max(shape->Get(shape->size() - 1), 0));
+
+			LabelTable table;
+			table.category_names.resize(num_categories);
+			table.display_names.resize(num_categories);
+
+			if (tensor_metadata_list && head_index < tensor_metadata_list->size()) {
+				const auto& tensor_metadata = *tensor_metadata_list->Get(head_index);
+				const auto labels_filename = ModelMetadataExtractor::FindFirstAssociatedFileName(
+					tensor_metadata, tflite::AssociatedFileType_TENSOR_AXIS_LABELS);
+				if (!labels_filename.empty()) {
+					MP_ASSIGN_OR_RETURN(auto labels_file, extractor->GetAssociatedFile(labels_filename));
+
+					const auto display_names_filename = ModelMetadataExtractor::FindFirstAssociatedFileName(
+						tensor_metadata, tflite::AssociatedFileType_TENSOR_AXIS_LABELS, display_names_locale);
+					absl::string_view display_names_file;
+					if (!display_names_filename.empty()) {
+						MP_ASSIGN_OR_RETURN(display_names_file, extractor->GetAssociatedFile(display_names_filename));
+					}
+
+					MP_ASSIGN_OR_RETURN(auto label_map, mediapipe::BuildLabelMapFromFiles(labels_file, display_names_file));
+					for (const auto& [index, item] : label_map) {
+						if (index >= 0 && static_cast<size_t>(index) < num_categories) {
+							table.category_names[index] = item.name();
+							table.display_names[index] = item.display_name();
+						}
+					}
+				}
+			}
+
+			auto& entry = label_tables->m_tables[static_cast<int>(head_index)];
+			entry.table = Intern(std::move(table));
+			entry.fixed = true;
+		}
+
+		return label_tables;
+	}
+
+	std::shared_ptr<CompactCategories> LabelTableCache::ToCompact(const ClassificationList& classifications, int head_index) {
+		const auto& list = classifications.classification();
+
+		size_t size = 0;
+		for (int i = 0; i < list.size(); i++) {
+			size = std::max(size, GetIndex(list, i) + 1);
+		}
+
+		std::shared_ptr<LabelTable> labels;
+
+		{
+			absl::MutexLock lock(&m_mutex);
+			auto& entry = m_tables[head_index];
+
+			bool complete = entry.fixed || (entry.table && size <= entry.known.size());
+			for (int i = 0; complete && !entry.fixed && i < list.size(); i++) {
+				complete = entry.known[GetIndex(list, i)];
+			}
+
+			if (!complete) {
+				LabelTable table = entry.table ? *entry.table : LabelTable();
+				size = std::max(size, entry.known.size());
+				table.category_names.resize(size);
+				table.display_names.resize(size);
+				entry.known.resize(size, false);
+
+				for (int i = 0; i < list.size(); i++) {
+					const auto index = GetIndex(list, i);
+					if (!entry.known[index]) {
+						table.category_names[index] = list[i].label();
+						table.display_names[index] = list[i].display_name();
+						entry.known[index] = true;
+					}
+				}
+
+				entry.table = Intern(std::move(table));
+			}
+
+			labels = entry.table;
+		}
+
+		const auto num_categories = labels->category_names.size();
+		cv::Mat scores(1, static_cast<int>(num_categories), CV_32F, cv::Scalar::all(std::numeric_limits<float>::quiet_NaN()));
+		auto* score = scores.ptr<float>();
+		for (int i = 0; i < list.size(); i++) {
+			const auto index = GetIndex(list, i);
+			if (index < num_categories) {
+				score[index] = list[i].score();
+			}
+		}
+
+		return std::make_shared<CompactCategories>(scores, labels);
+	}
+}
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "absl/status/statusor.h"
+#include "absl/synchronization/mutex.h"
 #include "mediapipe/framework/formats/classification.pb.h"
+#include <map>
 #include <opencv2/core/cvdef.h>
+#include <opencv2/core/mat.hpp>
 #include "binding/util.h"
 
 namespace mediapipe::tasks::lua::components::containers::category {
@@ -37,4 +41,84 @@ namespace mediapipe::tasks::lua::components::containers::category {
 		CV_PROP_RW std::string display_name;
 		CV_PROP_RW std::string category_name;
 	};
+
+	// Names of the categories of a model head, by category index.
+	// Tables are interned, every compact result of the same head shares the same table.
+	struct CV_EXPORTS_W_SIMPLE LabelTable {
+		CV_WRAP LabelTable(const LabelTable& other) = default;
+		LabelTable& operator=(const LabelTable& other) = default;
+
+		CV_WRAP LabelTable(
+			const std::vector<std::string>& category_names = std::vector<std::string>(),
+			const std::vector<std::string>& display_names = std::vector<std::string>()
+		)
+			:
+			category_names(category_names),
+			display_names(display_names)
+		{}
+
+		bool operator== (const LabelTable& other) const {
+			return ::mediapipe::lua::__eq__(category_names, other.category_names) &&
+				::mediapipe::lua::__eq__(display_names, other.display_names);
+		}
+
+		CV_PROP std::vector<std::string> category_names;
+		CV_PROP std::vector<std::string> display_names;
+	};
+
+	// Scores of a classification list as a 1 x N CV_32F matrix indexed by category index,
+	// categories that were not returned, because of max_results or score_threshold, have a NaN score
+	struct CV_EXPORTS_W_SIMPLE CompactCategories {
+		CV_WRAP CompactCategories(const CompactCategories& other) = default;
+		CompactCategories& operator=(const CompactCategories& other) = default;
+
+		CV_WRAP CompactCategories(
+			const cv::Mat& scores = cv::Mat(),
+			std::shared_ptr<LabelTable> labels = std::shared_ptr<LabelTable>()
+		)
+			:
+			scores(scores),
+			labels(labels)
+		{}
+
+		CV_WRAP std::shared_ptr<ClassificationList> to_pb2() const;
+
+		bool operator== (const CompactCategories& other) const {
+			return ::mediapipe::lua::__eq__(scores, other.scores) &&
+				::mediapipe::lua::__eq__(labels, other.labels);
+		}
+
+		CV_PROP_RW cv::Mat scores;
+		CV_PROP_RW std::shared_ptr<LabelTable> labels;
+	};
+
+	// Label tables of the heads of a task.
+	// Tables of a cache created from a model have one category per score of the head, and never change.
+	// Other tables grow with the results: names are copied when a category index is seen for the first time, then only scores are.
+	class LabelTableCache {
+	public:
+		/**
+		 * Creates the tables of the classification heads of a model, one per output tensor,
+		 * named from the label files of the model metadata in display_names_locale, if any.
+		 * The model is read from model_asset_buffer, or mapped from model_asset_path when the buffer is empty.
+		 */
+		[[nodiscard]] static absl::StatusOr<std::shared_ptr<LabelTableCache>> CreateFromModel(
+			const std::string& model_asset_path,
+			const std::string& model_asset_buffer,
+			const std::string& display_names_locale
+		);
+
+		std::shared_ptr<CompactCategories> ToCompact(const ClassificationList& classifications, int head_index = 0);
+
+	private:
+		struct Entry {
+			std::shared_ptr<LabelTable> table;
+			std::vector<bool> known;
+			// sized from the model, categories out of the table are dropped
+			bool fixed = false;
+		};
+
+		absl::Mutex m_mutex;
+		std::map<int, Entry> m_tables;
+	};
 }
@@ -7,6 +7,9 @@ namespace mediapipe::tasks::lua::components::containers::classification_result {
 		auto pb2_obj = std::make_shared<proto::Classifications>();
 
 		auto* classification_list = pb2_obj->mutable_classification_list();
+		if (compact) {
+			classification_list->CopyFrom(*compact->to_pb2());
+		}
 		for (const auto& category : categories) {
 			classification_list->add_classification()->CopyFrom(*category->to_pb2());
 		}
@@ -30,6 +33,15 @@ namespace mediapipe::tasks::lua::components::containers::classification_result {
 		);
 	}
 
+	std::shared_ptr<Classifications> Classifications::create_from_pb2(const proto::Classifications& pb2_obj, category::LabelTableCache& label_tables) {
+		return std::make_shared<Classifications>(
+			std::vector<std::shared_ptr<category::Category>>(),
+			pb2_obj.head_index(),
+			pb2_obj.head_name(),
+			label_tables.ToCompact(pb2_obj.classification_list(), pb2_obj.head_index())
+		);
+	}
+
 	std::shared_ptr<proto::ClassificationResult> ClassificationResult::to_pb2() const {
 		auto pb2_obj = std::make_shared<proto::ClassificationResult>();
 
@@ -50,4 +62,13 @@ namespace mediapipe::tasks::lua::components::containers::classification_result {
 		classification_result->timestamp_ms = pb2_obj.timestamp_ms();
 		return classification_result;
 	}
+
+	std::shared_ptr<ClassificationResult> ClassificationResult::create_from_pb2(const proto::ClassificationResult& pb2_obj, category::LabelTableCache& label_tables) {
+		auto classification_result = std::make_shared<ClassificationResult>();
+		for (const auto& classification : pb2_obj.classifications()) {
+			classification_result->classifications.push_back(std::move(Classifications::create_from_pb2(classification, label_tables)));
+		}
+		classification_result->timestamp_ms = pb2_obj.timestamp_ms();
+		return classification_result;
+	}
 }
@@ -12,26 +12,32 @@ namespace mediapipe::tasks::lua::components::containers::classification_result {
 		CV_WRAP Classifications(
 			const std::vector<std::shared_ptr<category::Category>>& categories = std::vector<std::shared_ptr<category::Category>>(),
 			int head_index = -1,
-			std::string head_name = std::string()
+			std::string head_name = std::string(),
+			std::shared_ptr<category::CompactCategories> compact = std::shared_ptr<category::CompactCategories>()
 		)
 			:
 			categories(categories),
 			head_index(head_index),
-			head_name(head_name)
+			head_name(head_name),
+			compact(compact)
 		{}
 
 		CV_WRAP std::shared_ptr<mediapipe::tasks::components::containers::proto::Classifications> to_pb2() const;
 		CV_WRAP static std::shared_ptr<Classifications> create_from_pb2(const mediapipe::tasks::components::containers::proto::Classifications& pb2_obj);
+		// Fills compact instead of categories
+		static std::shared_ptr<Classifications> create_from_pb2(const mediapipe::tasks::components::containers::proto::Classifications& pb2_obj, category::LabelTableCache& label_tables);
 
 		bool operator== (const Classifications& other) const {
 			return ::mediapipe::lua::__eq__(categories, other.categories) &&
 				::mediapipe::lua::__eq__(head_index, other.head_index) &&
-				::mediapipe::lua::__eq__(head_name, other.head_name);
+				::mediapipe::lua::__eq__(head_name, other.head_name) &&
+				::mediapipe::lua::__eq__(compact, other.compact);
 		}
 
 		CV_PROP_RW std::vector<std::shared_ptr<category::Category>> categories;
 		CV_PROP_RW int head_index;
 		CV_PROP_RW std::string head_name;
+		CV_PROP_RW std::shared_ptr<category::CompactCategories> compact;
 	};
 
 	struct CV_EXPORTS_W_SIMPLE ClassificationResult {
@@ -49,6 +55,7 @@ namespace mediapipe::tasks::lua::components::containers::classification_result {
 
 		CV_WRAP std::shared_ptr<mediapipe::tasks::components::containers::proto::ClassificationResult> to_pb2() const;
 		CV_WRAP static std::shared_ptr<ClassificationResult> create_from_pb2(const mediapipe::tasks::components::containers::proto::ClassificationResult& pb2_obj);
+		static std::shared_ptr<ClassificationResult> create_from_pb2(const mediapipe::tasks::components::containers::proto::ClassificationResult& pb2_obj, category::LabelTableCache& label_tables);
 
 		bool operator== (const ClassificationResult& other) const {
 			return ::mediapipe::lua::__eq__(classifications, other.classifications) &&
@@ -1,5 +1,51 @@
 #include "binding/tasks/components/containers/detections.h"
 
+namespace {
+	using mediapipe::tasks::lua::components::containers::detections::DenseDetections;
+
+	template<typename Detections>
+	std::shared_ptr<DenseDetections> DetectionsToDense(const Detections& detections) {
+		const int num_detections = detections.size();
+
+		int num_scores = 0;
+		int num_keypoints = 0;
+		for (const auto& detection : detections) {
+			num_scores = std::max(num_scores, detection.score_size());
+			num_keypoints = std::max(num_keypoints, detection.location_data().relative_keypoints_size());
+		}
+
+		cv::Mat boxes(num_detections, 4, CV_32S);
+		cv::Mat scores = cv::Mat::zeros(num_detections, num_scores, CV_32F);
+		cv::Mat label_ids(num_detections, 1, CV_32S);
+		cv::Mat keypoints = cv::Mat::zeros(num_detections, num_keypoints, CV_32FC2);
+
+		int i = 0;
+		for (const auto& detection : detections) {
+			const auto& bounding_box = detection.location_data().bounding_box();
+			auto* box = boxes.ptr<int>(i);
+			box[0] = bounding_box.xmin();
+			box[1] = bounding_box.ymin();
+			box[2] = bounding_box.width();
+			box[3] = bounding_box.height();
+
+			if (detection.score_size() != 0) {
+				std::copy(detection.score().begin(), detection.score().end(), scores.ptr<float>(i));
+			}
+
+			label_ids.at<int>(i) = detection.label_id_size() != 0 ? detection.label_id(0) : -1;
+
+			int j = 0;
+			for (const auto& relative_keypoint : detection.location_data().relative_keypoints()) {
+				keypoints.at<cv::Vec2f>(i, j++) = cv::Vec2f(relative_keypoint.x(), relative_keypoint.y());
+			}
+
+			i++;
+		}
+
+		return std::make_shared<DenseDetections>(boxes, scores, label_ids, keypoints);
+	}
+}
+
 namespace mediapipe::tasks::lua::components::containers::detections {
 	std::shared_ptr<mediapipe::Detection> Detection::to_pb2() const {
 		auto pb2_obj = std::make_shared<mediapipe::Detection>();
@@ -67,6 +113,14 @@ namespace mediapipe::tasks::lua::components::containers::detections {
 		);
 	}
 
+	std::shared_ptr<DenseDetections> DenseDetections::create_from_pb2(const mediapipe::DetectionList& pb2_obj) {
+		return DetectionsToDense(pb2_obj.detection());
+	}
+
+	std::shared_ptr<DenseDetections> DenseDetections::create_from_pb2(const std::vector<mediapipe::Detection>& pb2_obj) {
+		return DetectionsToDense(pb2_obj);
+	}
+
 	std::shared_ptr<mediapipe::DetectionList> DetectionResult::to_pb2() const {
 		auto pb2_obj = std::make_shared<mediapipe::DetectionList>();
 
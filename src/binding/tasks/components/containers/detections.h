@@ -5,6 +5,7 @@
 #include "binding/tasks/components/containers/bounding_box.h"
 #include "binding/tasks/components/containers/category.h"
 #include "binding/tasks/components/containers/keypoint.h"
+#include <opencv2/core/mat.hpp>
 
 namespace mediapipe::tasks::lua::components::containers::detections {
 	struct CV_EXPORTS_W_SIMPLE Detection {
@@ -36,24 +37,66 @@ namespace mediapipe::tasks::lua::components::containers::detections {
 		CV_PROP_RW std::vector<std::shared_ptr<keypoint::NormalizedKeypoint>> keypoints;
 	};
 
+	// Detections as matrices, row i of each matrix describes the i-th detection
+	struct CV_EXPORTS_W_SIMPLE DenseDetections {
+		CV_WRAP DenseDetections(const DenseDetections& other) = default;
+		DenseDetections& operator=(const DenseDetections& other) = default;
+
+		CV_WRAP DenseDetections(
+			const cv::Mat& boxes = cv::Mat(),
+			const cv::Mat& scores = cv::Mat(),
+			const cv::Mat& label_ids = cv::Mat(),
+			const cv::Mat& keypoints = cv::Mat()
+		)
+			:
+			boxes(boxes),
+			scores(scores),
+			label_ids(label_ids),
+			keypoints(keypoints)
+		{}
+
+		CV_WRAP static std::shared_ptr<DenseDetections> create_from_pb2(const mediapipe::DetectionList& pb2_obj);
+		static std::shared_ptr<DenseDetections> create_from_pb2(const std::vector<mediapipe::Detection>& pb2_obj);
+
+		bool operator== (const DenseDetections& other) const {
+			return ::mediapipe::lua::__eq__(boxes, other.boxes) &&
+				::mediapipe::lua::__eq__(scores, other.scores) &&
+				::mediapipe::lua::__eq__(label_ids, other.label_ids) &&
+				::mediapipe::lua::__eq__(keypoints, other.keypoints);
+		}
+
+		// N x 4 CV_32S, (origin_x, origin_y, width, height)
+		CV_PROP_RW cv::Mat boxes;
+		// N x K CV_32F, K is the largest number of categories of a detection, missing scores are 0
+		CV_PROP_RW cv::Mat scores;
+		// N x 1 CV_32S, label id of the first category, -1 when there is none
+		CV_PROP_RW cv::Mat label_ids;
+		// N x P CV_32FC2, (x, y) of the relative keypoints, P is the largest number of keypoints of a detection
+		CV_PROP_RW cv::Mat keypoints;
+	};
+
 	struct CV_EXPORTS_W_SIMPLE DetectionResult {
 		CV_WRAP DetectionResult(const DetectionResult& other) = default;
 		DetectionResult& operator=(const DetectionResult& other) = default;
 
 		CV_WRAP DetectionResult(
-			const std::vector<std::shared_ptr<detections::Detection>>& detections = std::vector<std::shared_ptr<detections::Detection>>()
+			const std::vector<std::shared_ptr<detections::Detection>>& detections = std::vector<std::shared_ptr<detections::Detection>>(),
+			std::shared_ptr<DenseDetections> dense = std::shared_ptr<DenseDetections>()
 		)
 			:
-			detections(detections)
+			detections(detections),
+			dense(dense)
 		{}
 
 		CV_WRAP std::shared_ptr<mediapipe::DetectionList> to_pb2() const;
 		CV_WRAP static std::shared_ptr<DetectionResult> create_from_pb2(const mediapipe::DetectionList& pb2_obj);
 
 		bool operator== (const DetectionResult& other) const {
-			return ::mediapipe::lua::__eq__(detections, other.detections);
+			return ::mediapipe::lua::__eq__(detections, other.detections) &&
+				::mediapipe::lua::__eq__(dense, other.dense);
 		}
 
 		CV_PROP_RW std::vector<std::shared_ptr<detections::Detection>> detections;
+		CV_PROP_RW std::shared_ptr<DenseDetections> dense;
 	};
 }
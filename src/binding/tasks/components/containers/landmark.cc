@@ -1,5 +1,22 @@
 #include "binding/tasks/components/containers/landmark.h"
 
+namespace {
+	template<typename LandmarkList>
+	cv::Mat LandmarkListToMat(const LandmarkList& landmarks) {
+		cv::Mat mat(landmarks.landmark_size(), 5, CV_32F);
+		auto* row = mat.ptr<float>();
+		for (const auto& landmark : landmarks.landmark()) {
+			row[0] = landmark.x();
+			row[1] = landmark.y();
+			row[2] = landmark.z();
+			row[3] = landmark.visibility();
+			row[4] = landmark.presence();
+			row += 5;
+		}
+		return mat;
+	}
+}
+
 namespace mediapipe::tasks::lua::components::containers::landmark {
 	std::shared_ptr<mediapipe::Landmark> Landmark::to_pb2() const {
 		auto pb2_obj = std::make_shared<mediapipe::Landmark>();
@@ -40,5 +57,12 @@ namespace mediapipe::tasks::lua::components::containers::landmark {
 			pb2_obj.presence()
 		);
 	}
-}
 
+	cv::Mat ToMat(const mediapipe::NormalizedLandmarkList& landmarks) {
+		return LandmarkListToMat(landmarks);
+	}
+
+	cv::Mat ToMat(const mediapipe::LandmarkList& landmarks) {
+		return LandmarkListToMat(landmarks);
+	}
+}
@@ -2,6 +2,7 @@
 
 #include "mediapipe/framework/formats/landmark.pb.h"
 #include <opencv2/core/cvdef.h>
+#include <opencv2/core/mat.hpp>
 #include "binding/util.h"
 
 namespace mediapipe::tasks::lua::components::containers::landmark {
@@ -78,4 +79,8 @@ namespace mediapipe::tasks::lua::components::containers::landmark {
 		CV_PROP_RW float visibility;
 		CV_PROP_RW float presence;
 	};
+
+	// Returns the landmarks as a N x 5 CV_32F matrix with one (x, y, z, visibility, presence) row per landmark
+	cv::Mat ToMat(const mediapipe::NormalizedLandmarkList& landmarks);
+	cv::Mat ToMat(const mediapipe::LandmarkList& landmarks);
 }
@@ -1,4 +1,5 @@
 #include "binding/tasks/core/base_options.h"
+#include "binding/util.h"
 #include <filesystem>
 
 namespace fs = std::filesystem;
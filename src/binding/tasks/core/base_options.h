@@ -6,6 +6,7 @@
 #include "mediapipe/tasks/cc/core/proto/external_file.pb.h"
 
 #include "absl/status/statusor.h"
+#include "binding/shared_executor.h"
 #include <opencv2/core/cvdef.h>
 #include <optional>
 
@@ -22,8 +23,10 @@ namespace mediapipe::tasks::lua::core::base_options {
 		CV_WRAP BaseOptions(
 			const std::string& model_asset_path = "",
 			const std::string& model_asset_buffer = "",
-			const std::optional<Delegate>& delegate = std::nullopt
-		) : model_asset_path(model_asset_path), model_asset_buffer(model_asset_buffer), delegate(delegate) {}
+			const std::optional<Delegate>& delegate = std::nullopt,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>(),
+			int warmup_frames = 0
+		) : model_asset_path(model_asset_path), model_asset_buffer(model_asset_buffer), delegate(delegate), executor(executor), warmup_frames(warmup_frames) {}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::core::proto::BaseOptions>> to_pb2() const;
 		CV_WRAP static std::shared_ptr<BaseOptions> create_from_pb2(const mediapipe::tasks::core::proto::BaseOptions& pb2_obj);
@@ -31,5 +34,10 @@ namespace mediapipe::tasks::lua::core::base_options {
 		CV_PROP_RW std::string model_asset_path;
 		CV_PROP_RW std::string model_asset_buffer;
 		CV_PROP_RW std::optional<Delegate> delegate;
+		// Executor the task graph runs on, the process-wide default when not set
+		CV_PROP_RW std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor> executor;
+		// Number of synthetic inputs create_from_options runs through the task before returning it,
+		// video, live stream and audio stream tasks are not warmed up
+		CV_PROP_RW int warmup_frames;
 	};
 }
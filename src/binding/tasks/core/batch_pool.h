@@ -0,0 +1,62 @@
+#pragma once
+
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "binding/instance_pool.h"
+#include "binding/util.h"
+#include <memory>
+#include <vector>
+
+namespace mediapipe::tasks::lua::core::batch_pool {
+	/**
+	 * Processes requests concurrently on num_workers instances of task, 4 or the number of hardware threads if lower
+	 * when num_workers is 0, and returns their responses in request order, or the first error.
+	 *
+	 * With a single worker or a single request, requests are processed on task itself in the calling thread.
+	 * Otherwise the instances are made by create_instance on the first call and kept in pool for the next calls with as many workers.
+	 * Instances share the mapped model file, but each one runs its own graph, with its own interpreter and tensor arena.
+	 */
+	template<typename Instance, typename Request, typename Response, typename _Creator>
+	[[nodiscard]] absl::StatusOr<std::vector<Response>> ProcessBatch(
+		Instance& task,
+		std::unique_ptr<mediapipe::lua::instance_pool::InstancePool<Instance, Request, Response>>& pool,
+		std::vector<Request>&& requests,
+		int num_workers,
+		_Creator&& create_instance,
+		const typename mediapipe::lua::instance_pool::InstancePool<Instance, Request, Response>::Processor& processor
+	) {
+		using mediapipe::lua::instance_pool::DispatchPolicy;
+		using mediapipe::lua::instance_pool::InstancePool;
+
+		MP_ASSERT_RETURN_IF_ERROR(num_workers >= 0, "num_workers must be greater than or equal to 0");
+
+		if (num_workers == 0) {
+			num_workers = mediapipe::lua::instance_pool::GetDefaultNumWorkers();
+		}
+
+		if (num_workers == 1 || requests.size() <= 1) {
+			std::vector<Response> responses;
+			responses.reserve(requests.size());
+			for (auto& request : requests) {
+				MP_ASSIGN_OR_RETURN(auto response, processor(task, std::move(request)));
+				responses.push_back(std::move(response));
+			}
+			return responses;
+		}
+
+		if (!pool || pool->size() != static_cast<size_t>(num_workers)) {
+			pool.reset();
+
+			std::vector<std::shared_ptr<Instance>> instances;
+			instances.reserve(num_workers);
+			for (int i = 0; i < num_workers; i++) {
+				MP_ASSIGN_OR_RETURN(auto instance, create_instance());
+				instances.push_back(std::move(instance));
+			}
+
+			pool = std::make_unique<InstancePool<Instance, Request, Response>>(instances, processor, DispatchPolicy::LEAST_LOADED);
+		}
+
+		return pool->ProcessAll(std::move(requests));
+	}
+}
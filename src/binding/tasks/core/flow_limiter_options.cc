@@ -0,0 +1,14 @@
+#include "binding/tasks/core/flow_limiter_options.h"
+#include "binding/util.h"
+
+namespace mediapipe::tasks::lua::core::flow_limiter_options {
+	absl::StatusOr<std::shared_ptr<mediapipe::FlowLimiterCalculatorOptions>> FlowLimiterOptions::to_pb2() const {
+		MP_ASSERT_RETURN_IF_ERROR(max_in_flight >= 1, "max_in_flight must be greater than 0");
+		MP_ASSERT_RETURN_IF_ERROR(max_in_queue >= 0, "max_in_queue must be greater than or equal to 0");
+
+		auto options = std::make_shared<mediapipe::FlowLimiterCalculatorOptions>();
+		options->set_max_in_flight(max_in_flight);
+		options->set_max_in_queue(drop_policy == DropPolicy::DROP_NEWEST ? 0 : max_in_queue);
+		return options;
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "mediapipe/calculators/core/flow_limiter_calculator.pb.h"
+
+#include "absl/status/statusor.h"
+#include <opencv2/core/cvdef.h>
+
+namespace mediapipe::tasks::lua::core::flow_limiter_options {
+	/**
+	 * Options of the FlowLimiterCalculator inserted in front of live stream tasks.
+	 * The defaults process one frame at a time and keep only the latest pending frame.
+	 */
+	struct CV_EXPORTS_W_SIMPLE FlowLimiterOptions {
+		enum class DropPolicy {
+			// Pending frames beyond max_in_queue are dropped, oldest first
+			DROP_OLDEST = 0,
+			// Frames arriving while max_in_flight frames are processed are dropped, max_in_queue is ignored
+			DROP_NEWEST = 1,
+		};
+
+		CV_WRAP FlowLimiterOptions(const FlowLimiterOptions& other) = default;
+		FlowLimiterOptions& operator=(const FlowLimiterOptions& other) = default;
+
+		CV_WRAP FlowLimiterOptions(
+			int max_in_flight = 1,
+			int max_in_queue = 1,
+			DropPolicy drop_policy = DropPolicy::DROP_OLDEST
+		) : max_in_flight(max_in_flight), max_in_queue(max_in_queue), drop_policy(drop_policy) {}
+
+		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::FlowLimiterCalculatorOptions>> to_pb2() const;
+
+		CV_PROP_RW int max_in_flight;
+		CV_PROP_RW int max_in_queue;
+		CV_PROP_RW DropPolicy drop_policy;
+	};
+}
@@ -0,0 +1,15 @@
+#include "binding/shared_executor.h"
+#include "binding/tasks/core/task_future.h"
+#include <algorithm>
+#include <thread>
+
+namespace mediapipe::tasks::lua::core::task_future {
+	using mediapipe::lua::shared_executor::SharedExecutor;
+
+	void Schedule(std::function<void()>&& task) {
+		// never destroyed, a factory may still be running at exit
+		static const auto* pool = new std::shared_ptr<SharedExecutor>(*SharedExecutor::create(
+			std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, kMaxCreationThreads)));
+		(*pool)->get_executor()->Schedule(std::move(task));
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "absl/status/statusor.h"
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+
+namespace mediapipe::tasks::lua::core::task_future {
+	// Runs task on the creation pool, a process-wide pool of at most kMaxCreationThreads threads.
+	// It is not the default shared executor: a factory waits for its graph, that may run on that executor.
+	constexpr int kMaxCreationThreads = 4;
+	void Schedule(std::function<void()>&& task);
+
+	// Creates a task on the creation pool.
+	//
+	// The factory must not touch the lua state. The options it was created from are kept by the future,
+	// so that they are released on the lua thread, and the destructor waits for the creation to end.
+	template<typename _Tp>
+	class TaskFuture {
+	public:
+		using Result = absl::StatusOr<std::shared_ptr<_Tp>>;
+		using Factory = std::function<Result()>;
+
+		TaskFuture(Factory&& factory, std::shared_ptr<const void> options)
+			: m_options(std::move(options)), m_factory(std::make_shared<Factory>(std::move(factory))) {
+			auto promise = std::make_shared<std::promise<Result>>();
+			m_future = promise->get_future();
+
+			// the pool drops its reference to the factory before the future is ready,
+			// what the factory captured is released with this future
+			Schedule([promise, factory = m_factory]() mutable {
+				try {
+					auto result = (*factory)();
+					factory.reset();
+					promise->set_value(std::move(result));
+				}
+				catch (...) {
+					factory.reset();
+					promise->set_exception(std::current_exception());
+				}
+			});
+		}
+
+		~TaskFuture() {
+			if (m_future.valid()) {
+				m_future.wait();
+			}
+		}
+
+		TaskFuture(const TaskFuture&) = delete;
+		TaskFuture& operator=(const TaskFuture&) = delete;
+
+		bool ready() const {
+			return m_result.has_value() || m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}
+
+		Result get() {
+			if (!m_result) {
+				m_result = m_future.get();
+			}
+			return *m_result;
+		}
+
+	private:
+		std::shared_ptr<const void> m_options;
+		std::shared_ptr<Factory> m_factory;
+		std::future<Result> m_future;
+		std::optional<Result> m_result;
+	};
+}
@@ -14,7 +14,10 @@ namespace {
 }
 
 namespace mediapipe::tasks::lua::core::task_info {
-	absl::StatusOr<std::shared_ptr<CalculatorGraphConfig>> TaskInfo::generate_graph_config(bool enable_flow_limiting) {
+	absl::StatusOr<std::shared_ptr<CalculatorGraphConfig>> TaskInfo::generate_graph_config(
+		bool enable_flow_limiting,
+		std::shared_ptr<flow_limiter_options::FlowLimiterOptions> flow_limiter_options
+	) {
 		MP_ASSERT_RETURN_IF_ERROR(!task_graph.empty() && task_options, "Please provide both `task_graph` and `task_options`.");
 		MP_ASSERT_RETURN_IF_ERROR(
 			!input_streams.empty() &&
@@ -68,8 +71,11 @@ namespace mediapipe::tasks::lua::core::task_info {
 		auto finished_stream = "FINISHED:" + strip_tag_index(output_streams.at(0));
 		flow_limiter->add_input_stream(finished_stream);
 
-		flow_limiter->mutable_options()->MutableExtension(FlowLimiterCalculatorOptions::ext)->set_max_in_flight(1);
-		flow_limiter->mutable_options()->MutableExtension(FlowLimiterCalculatorOptions::ext)->set_max_in_queue(1);
+		if (!flow_limiter_options) {
+			flow_limiter_options = std::make_shared<flow_limiter_options::FlowLimiterOptions>();
+		}
+		MP_ASSIGN_OR_RETURN(auto flow_limiter_options_proto, flow_limiter_options->to_pb2());
+		flow_limiter->mutable_options()->MutableExtension(FlowLimiterCalculatorOptions::ext)->CopyFrom(*flow_limiter_options_proto);
 
 		return graph_config;
 	}
@@ -7,6 +7,7 @@
 #include "mediapipe/framework/calculator_options.pb.h"
 #include "mediapipe/framework/calculator.pb.h"
 #include "binding/tasks/core/base_options.h"
+#include "binding/tasks/core/flow_limiter_options.h"
 
 namespace mediapipe::tasks::lua::core::task_info {
 	struct CV_EXPORTS_W_SIMPLE TaskInfo {
@@ -25,7 +26,10 @@ namespace mediapipe::tasks::lua::core::task_info {
 			task_options(task_options)
 		{}
 
-		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::CalculatorGraphConfig>> generate_graph_config(bool enable_flow_limiting = true);
+		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::CalculatorGraphConfig>> generate_graph_config(
+			bool enable_flow_limiting = true,
+			std::shared_ptr<flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<flow_limiter_options::FlowLimiterOptions>()
+		);
 
 		CV_PROP_RW std::string task_graph;
 		CV_PROP_RW std::vector<std::string> input_streams;
@@ -1,5 +1,6 @@
 #include "mediapipe/framework/port/status_macros.h"
 #include "binding/tasks/core/task_runner.h"
+#include "binding/model_asset_registry.h"
 #include "binding/util.h"
 
 namespace {
@@ -8,22 +9,35 @@ namespace {
 	using ::mediapipe::tasks::core::TaskRunner;
 }  // namespace
 
-// A mutex to guard the callback function. Only one callback can
-// run at once.
-absl::Mutex callback_mutex;
-
 namespace mediapipe::lua::task_runner {
-	absl::StatusOr<std::shared_ptr<TaskRunner>> create(const CalculatorGraphConfig& graph_config) {
+	absl::StatusOr<std::shared_ptr<TaskRunner>> create(
+		const CalculatorGraphConfig& graph_config,
+		const std::shared_ptr<shared_executor::SharedExecutor>& executor
+	) {
 		PacketsCallback packets_callback = nullptr;
-		return create(graph_config, std::move(packets_callback));
+		return create(graph_config, std::move(packets_callback), executor);
 	}
 
-	absl::StatusOr<std::shared_ptr<TaskRunner>> create(const CalculatorGraphConfig& graph_config, PacketsCallback&& packets_callback) {
+	absl::StatusOr<std::shared_ptr<TaskRunner>> create(
+		const CalculatorGraphConfig& graph_config,
+		PacketsCallback&& packets_callback,
+		const std::shared_ptr<shared_executor::SharedExecutor>& executor
+	) {
+		// Every task created on the same file shares the same read-only mapping,
+		// which stays mapped as long as the runner uses it
+		CalculatorGraphConfig mapped_graph_config = graph_config;
+		std::vector<std::shared_ptr<const model_asset_registry::ModelAsset>> model_assets;
+		MP_RETURN_IF_ERROR(model_asset_registry::MapExternalFiles(mapped_graph_config, model_assets));
+
 		mediapipe::tasks::core::PacketsCallback callback = nullptr;
 
 		if (packets_callback) {
-			callback = [packets_callback = std::move(packets_callback)](absl::StatusOr<PacketMap> output_packets) {
-				absl::MutexLock lock(&callback_mutex);
+			// A mutex to guard the callback function of this runner. Only one callback can
+			// run at once, callbacks of different runners do not wait for each other.
+			auto callback_mutex = std::make_shared<absl::Mutex>();
+
+			callback = [packets_callback = std::move(packets_callback), callback_mutex](absl::StatusOr<PacketMap> output_packets) {
+				absl::MutexLock lock(callback_mutex.get());
 				MP_THROW_IF_ERROR(output_packets.status()); // There is no other choice than throw in a callback to stop the execution
 				packets_callback(output_packets.value());
 				return absl::OkStatus();
@@ -38,19 +52,22 @@ namespace mediapipe::lua::task_runner {
 			gpu_resources_ = nullptr;
 		}
 		MP_ASSIGN_OR_RETURN(auto task_runner, TaskRunner::Create(
-			std::move(graph_config),
+			std::move(mapped_graph_config),
 			absl::make_unique<MediaPipeBuiltinOpResolver>(),
 			std::move(callback),
-			/* default_executor= */ nullptr,
+			/* default_executor= */ shared_executor::SharedExecutor::GetExecutorOrDefault(executor),
 			/* input_side_packes= */ std::nullopt, std::move(*gpu_resources_)));
 #else
 		MP_ASSIGN_OR_RETURN(auto task_runner, TaskRunner::Create(
-			std::move(graph_config),
+			std::move(mapped_graph_config),
 			absl::make_unique<MediaPipeBuiltinOpResolver>(),
-			std::move(callback)));
+			std::move(callback),
+			/* default_executor= */ shared_executor::SharedExecutor::GetExecutorOrDefault(executor)));
 #endif  // !MEDIAPIPE_DISABLE_GPU
 
-		return std::shared_ptr<TaskRunner>(task_runner.release());
+		return std::shared_ptr<TaskRunner>(task_runner.release(), [model_assets = std::move(model_assets)](TaskRunner* runner) {
+			delete runner;
+		});
 
 	}
 }
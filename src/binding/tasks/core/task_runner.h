@@ -5,6 +5,7 @@
 #include "mediapipe/tasks/cc/core/mediapipe_builtin_op_resolver.h"
 #include "mediapipe/tasks/cc/core/task_runner.h"
 #include "tensorflow/lite/core/api/op_resolver.h"
+#include "binding/shared_executor.h"
 #if !MEDIAPIPE_DISABLE_GPU
 #include "mediapipe/gpu/gpu_shared_data_internal.h"
 #endif  // MEDIAPIPE_DISABLE_GPU
@@ -13,7 +14,15 @@
 namespace mediapipe::lua {
 	using PacketsCallback = std::function<void(const ::mediapipe::tasks::core::PacketMap&)>;
 	namespace task_runner {
-		[[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::core::TaskRunner>> create(const CalculatorGraphConfig& graph_config);
-		[[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::core::TaskRunner>> create(const CalculatorGraphConfig& graph_config, PacketsCallback&& packets_callback);
+		// An empty executor runs the graph on the default shared executor, if any, or on its own thread pool.
+		[[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::core::TaskRunner>> create(
+			const CalculatorGraphConfig& graph_config,
+			const std::shared_ptr<shared_executor::SharedExecutor>& executor = nullptr
+		);
+		[[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::core::TaskRunner>> create(
+			const CalculatorGraphConfig& graph_config,
+			PacketsCallback&& packets_callback,
+			const std::shared_ptr<shared_executor::SharedExecutor>& executor = nullptr
+		);
 	}
 }
@@ -1,6 +1,11 @@
+#include "mediapipe/framework/tool/validate_name.h"
 #include "binding/tasks/text/core/base_text_task_api.h"
 #include "binding/util.h"
 
+namespace {
+	const std::string _WARMUP_TEXT = "The quick brown fox jumps over the lazy dog.";
+}
+
 namespace mediapipe::tasks::lua::text::core::base_text_task_api {
 	BaseTextTaskApi::~BaseTextTaskApi() {
 		auto status = close();
@@ -10,12 +15,61 @@ namespace mediapipe::tasks::lua::text::core::base_text_task_api {
 	}
 
 	absl::StatusOr<std::shared_ptr<BaseTextTaskApi>> BaseTextTaskApi::create(
-		const CalculatorGraphConfig& graph_config
+		const CalculatorGraphConfig& graph_config,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
-		return create(graph_config, static_cast<BaseTextTaskApi*>(nullptr));
+		return create(graph_config, static_cast<BaseTextTaskApi*>(nullptr), executor);
+	}
+
+	absl::Status BaseTextTaskApi::warmup(int num_texts) {
+		if (num_texts <= 0) {
+			return absl::OkStatus();
+		}
+
+		std::map<std::string, Packet> inputs;
+		for (const auto& input_stream : _runner->GetGraphConfig().input_stream()) {
+			std::string tag;
+			std::string name;
+			MP_RETURN_IF_ERROR(mediapipe::tool::ParseTagAndName(input_stream, &tag, &name));
+
+			if (tag != "TEXT") {
+				return absl::OkStatus();
+			}
+			inputs[name] = mediapipe::MakePacket<std::string>(_WARMUP_TEXT);
+		}
+
+		for (int i = 0; i < num_texts; i++) {
+			MP_RETURN_IF_ERROR(_runner->Process(inputs).status());
+		}
+
+		return absl::OkStatus();
+	}
+
+	absl::StatusOr<std::vector<std::map<std::string, Packet>>> BaseTextTaskApi::_process_texts(
+		std::vector<std::map<std::string, Packet>>&& inputs,
+		int num_workers
+	) {
+		using PacketMap = std::map<std::string, Packet>;
+
+		return mediapipe::tasks::lua::core::batch_pool::ProcessBatch<BaseTextTaskApi, PacketMap, PacketMap>(*this, _batch_pool, std::move(inputs), num_workers,
+			[this]() {
+				return create(_runner->GetGraphConfig(), _executor);
+			},
+			[](BaseTextTaskApi& task, PacketMap&& text_inputs) {
+				return task._runner->Process(text_inputs);
+			}
+		);
 	}
 
 	absl::Status BaseTextTaskApi::close() {
 		return _runner->Close();
 	}
+
+	bool TextTaskFuture::ready() const {
+		return m_future.ready();
+	}
+
+	absl::StatusOr<std::shared_ptr<BaseTextTaskApi>> TextTaskFuture::get() {
+		return m_future.get();
+	}
 }
@@ -2,10 +2,17 @@
 
 #include "mediapipe/framework/calculator.pb.h"
 #include "mediapipe/framework/port/status_macros.h"
+#include "binding/instance_pool.h"
+#include "binding/packet.h"
+#include "binding/packet_getter.h"
+#include "binding/tasks/core/batch_pool.h"
+#include "binding/tasks/core/task_future.h"
 #include "binding/tasks/core/task_runner.h"
+#include "binding/tasks/text/core/result_cache.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include <opencv2/core/cvdef.h>
+#include <type_traits>
 
 namespace mediapipe::tasks::lua::text::core::base_text_task_api {
 	class CV_EXPORTS_W BaseTextTaskApi {
@@ -15,10 +22,13 @@ namespace mediapipe::tasks::lua::text::core::base_text_task_api {
 		template<typename _Tp>
 		[[nodiscard]] inline static absl::StatusOr<std::shared_ptr<_Tp>> create(
 			const CalculatorGraphConfig& graph_config,
-			_Tp*
+			_Tp*,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		) {
-			MP_ASSIGN_OR_RETURN(auto runner, mediapipe::lua::task_runner::create(graph_config));
-			return std::make_shared<_Tp>(runner);
+			MP_ASSIGN_OR_RETURN(auto runner, mediapipe::lua::task_runner::create(graph_config, executor));
+			auto task = std::make_shared<_Tp>(runner);
+			task->_executor = executor;
+			return task;
 		}
 
 		BaseTextTaskApi(
@@ -26,10 +36,94 @@ namespace mediapipe::tasks::lua::text::core::base_text_task_api {
 		) : _runner(runner) {}
 
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<BaseTextTaskApi>> create(
-			const CalculatorGraphConfig& graph_config
+			const CalculatorGraphConfig& graph_config,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
+		/**
+		 * Runs num_texts short texts through the task, so that tensor allocation and weight packing
+		 * happen before the first real text.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status warmup(int num_texts = 1);
 		CV_WRAP [[nodiscard]] absl::Status close();
 	protected:
+		// Processes the texts of inputs with batch_pool::ProcessBatch, on instances of the graph of the task created on its executor
+		[[nodiscard]] absl::StatusOr<std::vector<std::map<std::string, Packet>>> _process_texts(
+			std::vector<std::map<std::string, Packet>>&& inputs,
+			int num_workers
+		);
+
+		/**
+		 * Returns the results of texts in input order.
+		 * Texts found in result_cache, if any, are not processed, the other ones are processed by _process_texts
+		 * and the _Proto of their result_stream_name output is added to result_cache.
+		 * build_result turns every _Proto, cached or not, into a new result.
+		 */
+		template<typename _Proto, typename _Builder, typename _Result = typename std::invoke_result_t<_Builder&, const _Proto&>::value_type>
+		[[nodiscard]] absl::StatusOr<std::vector<_Result>> _process_texts_to_results(
+			const std::vector<std::string>& texts,
+			const std::string& text_stream_name,
+			const std::string& result_stream_name,
+			result_cache::ResultCache<_Proto>* result_cache,
+			int num_workers,
+			_Builder&& build_result
+		) {
+			std::vector<_Result> results(texts.size());
+			std::vector<size_t> processed;
+			std::vector<std::map<std::string, Packet>> inputs;
+
+			for (size_t i = 0; i < texts.size(); i++) {
+				if (result_cache) {
+					if (auto result_proto = result_cache->Get(texts[i])) {
+						MP_ASSIGN_OR_RETURN(results[i], build_result(*result_proto));
+						continue;
+					}
+				}
+
+				processed.push_back(i);
+				inputs.push_back({
+					{ text_stream_name, std::move(MakePacket<std::string>(texts[i])) },
+					});
+			}
+
+			MP_ASSIGN_OR_RETURN(auto outputs, _process_texts(std::move(inputs), num_workers));
+
+			for (size_t i = 0; i < outputs.size(); i++) {
+				const auto& packet = outputs[i].at(result_stream_name);
+				MP_PACKET_ASSIGN_OR_RETURN(const auto& result_proto, _Proto, packet);
+				MP_ASSIGN_OR_RETURN(results[processed[i]], build_result(result_proto));
+				if (result_cache) {
+					// the cached proto is the immutable packet payload, kept alive by a copy of the packet
+					auto holder = std::make_shared<const Packet>(packet);
+					result_cache->Put(texts[processed[i]], std::shared_ptr<const _Proto>(holder, &result_proto), result_proto.ByteSizeLong());
+				}
+			}
+
+			return results;
+		}
+
 		std::shared_ptr<mediapipe::tasks::core::TaskRunner> _runner;
+		// the executor the task was created with, shared by its batch instances
+		std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor> _executor;
+		std::unique_ptr<mediapipe::lua::instance_pool::InstancePool<BaseTextTaskApi, std::map<std::string, Packet>, std::map<std::string, Packet>>> _batch_pool;
+	};
+
+	// A text task being created in the background by create_from_options_async
+	class CV_EXPORTS_W TextTaskFuture {
+	public:
+		template<typename _Options, typename _Tp>
+		TextTaskFuture(
+			const std::shared_ptr<_Options>& options,
+			absl::StatusOr<std::shared_ptr<_Tp>>(*create_from_options)(std::shared_ptr<_Options>)
+		) : m_future([options, create_from_options]() -> absl::StatusOr<std::shared_ptr<BaseTextTaskApi>> {
+			return create_from_options(options);
+		}, options) {}
+
+		// Whether get returns without waiting
+		CV_WRAP bool ready() const;
+
+		// Waits for the task to be created and returns it
+		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<BaseTextTaskApi>> get();
+	private:
+		mediapipe::tasks::lua::core::task_future::TaskFuture<BaseTextTaskApi> m_future;
 	};
 }
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "absl/status/statusor.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "binding/tasks/text/core/result_cache_options.h"
+#include "binding/util.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace mediapipe::tasks::lua::text::core::result_cache {
+	struct CV_EXPORTS_W_SIMPLE ResultCacheStats {
+		CV_WRAP ResultCacheStats(const ResultCacheStats& other) = default;
+		ResultCacheStats& operator=(const ResultCacheStats& other) = default;
+
+		CV_WRAP ResultCacheStats(
+			int64_t hits = 0,
+			int64_t misses = 0,
+			int size = 0,
+			int64_t bytes = 0
+		) : hits(hits), misses(misses), size(size), bytes(bytes) {}
+
+		// Number of texts whose result was found in the cache
+		CV_PROP_RW int64_t hits;
+		// Number of texts that were run through the graph
+		CV_PROP_RW int64_t misses;
+		// Number of cached results
+		CV_PROP_RW int size;
+		// Estimated size of the cached texts and results
+		CV_PROP_RW int64_t bytes;
+	};
+
+	// Least recently used result protos of a text task, keyed by their input text.
+	//
+	// A cache belongs to a single task, whose options cannot change, so the text is the whole key.
+	// Cached protos are read-only, the task builds a new result from them on every hit
+	// so that callers may modify what they get.
+	template<typename _Tp>
+	class ResultCache {
+	public:
+		[[nodiscard]] static absl::StatusOr<std::unique_ptr<ResultCache>> Create(const result_cache_options::ResultCacheOptions& options) {
+			MP_ASSERT_RETURN_IF_ERROR(options.capacity > 0, "capacity must be greater than 0");
+			MP_ASSERT_RETURN_IF_ERROR(options.max_bytes > 0, "max_bytes must be greater than 0");
+			return std::make_unique<ResultCache>(options);
+		}
+
+		explicit ResultCache(const result_cache_options::ResultCacheOptions& options) : m_options(options) {}
+
+		// Returns the cached result of text, or nothing
+		std::shared_ptr<const _Tp> Get(const std::string& text) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			auto found = m_index.find(text);
+			if (found == m_index.end()) {
+				m_stats.misses++;
+				return nullptr;
+			}
+
+			m_stats.hits++;
+			m_entries.splice(m_entries.begin(), m_entries, found->second);
+			return found->second->result;
+		}
+
+		// Caches the result of text, bytes being its estimated size
+		void Put(const std::string& text, const std::shared_ptr<const _Tp>& result, size_t bytes) {
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			bytes += text.size();
+			if (bytes > static_cast<size_t>(m_options.max_bytes)) {
+				return;
+			}
+
+			auto found = m_index.find(text);
+			if (found != m_index.end()) {
+				Erase(found->second);
+			}
+
+			m_entries.push_front({ text, result, bytes });
+			// the key views the text of the entry, which does not move until it is erased
+			m_index.emplace(m_entries.front().text, m_entries.begin());
+			m_stats.size++;
+			m_stats.bytes += bytes;
+
+			while (m_stats.size > m_options.capacity || m_stats.bytes > m_options.max_bytes) {
+				Erase(std::prev(m_entries.end()));
+			}
+		}
+
+		void Clear() {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_index.clear();
+			m_entries.clear();
+			m_stats.size = 0;
+			m_stats.bytes = 0;
+		}
+
+		ResultCacheStats stats() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_stats;
+		}
+
+	private:
+		struct Entry {
+			std::string text;
+			std::shared_ptr<const _Tp> result;
+			size_t bytes;
+		};
+
+		void Erase(typename std::list<Entry>::iterator entry) {
+			m_stats.size--;
+			m_stats.bytes -= entry->bytes;
+			m_index.erase(entry->text);
+			m_entries.erase(entry);
+		}
+
+		result_cache_options::ResultCacheOptions m_options;
+		mutable std::mutex m_mutex;
+		// most recently used first
+		std::list<Entry> m_entries;
+		std::unordered_map<std::string_view, typename std::list<Entry>::iterator> m_index;
+		ResultCacheStats m_stats;
+	};
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <opencv2/core/cvdef.h>
+
+namespace mediapipe::tasks::lua::text::core::result_cache_options {
+	/**
+	 * Options of the result cache of text tasks.
+	 * Texts seen recently are not run through the graph, the result of their last run is returned instead.
+	 * The least recently used results are evicted once either limit is reached.
+	 */
+	struct CV_EXPORTS_W_SIMPLE ResultCacheOptions {
+		CV_WRAP ResultCacheOptions(const ResultCacheOptions& other) = default;
+		ResultCacheOptions& operator=(const ResultCacheOptions& other) = default;
+
+		CV_WRAP ResultCacheOptions(
+			int capacity = 4096,
+			int64_t max_bytes = 64 << 20
+		) : capacity(capacity), max_bytes(max_bytes) {}
+
+		// Maximum number of cached results
+		CV_PROP_RW int capacity;
+		// Maximum size of the cached texts and results, results being estimated from the size of their serialized outputs
+		CV_PROP_RW int64_t max_bytes;
+	};
+}
@@ -10,6 +10,8 @@ namespace {
 	using namespace mediapipe::tasks::lua::text::language_detector;
 	using namespace mediapipe::tasks::text::text_classifier::proto;
 
+	using ClassificationResultProto = mediapipe::tasks::components::containers::proto::ClassificationResult;
+
 	const std::string _CLASSIFICATIONS_STREAM_NAME = "classifications_out";
 	const std::string _CLASSIFICATIONS_TAG = "CLASSIFICATIONS";
 	const std::string _TEXT_IN_STREAM_NAME = "text_in";
@@ -56,10 +58,11 @@ namespace mediapipe::tasks::lua::text::language_detector {
 	}
 
 	absl::StatusOr<std::shared_ptr<LanguageDetector>> LanguageDetector::create(
-		const CalculatorGraphConfig& graph_config
+		const CalculatorGraphConfig& graph_config,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseTextTaskApi = core::base_text_task_api::BaseTextTaskApi;
-		return BaseTextTaskApi::create(graph_config, static_cast<LanguageDetector*>(nullptr));
+		return BaseTextTaskApi::create(graph_config, static_cast<LanguageDetector*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<LanguageDetector>> LanguageDetector::create_from_model_path(const std::string& model_path) {
@@ -76,16 +79,41 @@ namespace mediapipe::tasks::lua::text::language_detector {
 
 		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config());
 
-		return create(*config);
+		MP_ASSIGN_OR_RETURN(auto task, create(*config, options->base_options ? options->base_options->executor : nullptr));
+		if (options->result_cache_options) {
+			MP_ASSIGN_OR_RETURN(task->_result_cache, core::result_cache::ResultCache<ClassificationResultProto>::Create(*options->result_cache_options));
+		}
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		return task;
+	}
+
+	std::shared_ptr<core::base_text_task_api::TextTaskFuture> LanguageDetector::create_from_options_async(std::shared_ptr<LanguageDetectorOptions> options) {
+		return std::make_shared<core::base_text_task_api::TextTaskFuture>(options, &LanguageDetector::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<LanguageDetectorResult>> LanguageDetector::detect(const std::string& text) {
-		MP_ASSIGN_OR_RETURN(auto output_packets, _runner->Process({
-			{ _TEXT_IN_STREAM_NAME, std::move(MakePacket<std::string>(text)) }
+		MP_ASSIGN_OR_RETURN(auto results, _process_texts_to_results<ClassificationResultProto>(
+			{ text }, _TEXT_IN_STREAM_NAME, _CLASSIFICATIONS_STREAM_NAME, _result_cache.get(), 1,
+			[](const ClassificationResultProto& classification_result_proto) {
+				return _extract_language_detector_result(*_ClassificationResult::create_from_pb2(classification_result_proto));
 			}));
+		return results[0];
+	}
+
+	absl::Status LanguageDetector::detect_batch(
+		std::vector<std::shared_ptr<LanguageDetectorResult>>& results,
+		const std::vector<std::string>& texts,
+		int num_workers
+	) {
+		MP_ASSIGN_OR_RETURN(results, _process_texts_to_results<ClassificationResultProto>(
+			texts, _TEXT_IN_STREAM_NAME, _CLASSIFICATIONS_STREAM_NAME, _result_cache.get(), num_workers,
+			[](const ClassificationResultProto& classification_result_proto) {
+				return _extract_language_detector_result(*_ClassificationResult::create_from_pb2(classification_result_proto));
+			}));
+		return absl::OkStatus();
+	}
 
-		MP_PACKET_ASSIGN_OR_RETURN(const auto& classification_result_proto, mediapipe::tasks::components::containers::proto::ClassificationResult, output_packets.at(_CLASSIFICATIONS_STREAM_NAME));
-		const auto& classification_result = _ClassificationResult::create_from_pb2(classification_result_proto);
-		return _extract_language_detector_result(*classification_result);
+	core::result_cache::ResultCacheStats LanguageDetector::result_cache_stats() const {
+		return _result_cache ? _result_cache->stats() : core::result_cache::ResultCacheStats();
 	}
 }
@@ -54,7 +54,8 @@ namespace mediapipe::tasks::lua::text::language_detector {
 			const std::optional<int>& max_results = std::nullopt,
 			const std::optional<float>& score_threshold = std::nullopt,
 			const std::vector<std::string>& category_allowlist = std::vector<std::string>(),
-			const std::vector<std::string>& category_denylist = std::vector<std::string>()
+			const std::vector<std::string>& category_denylist = std::vector<std::string>(),
+			std::shared_ptr<core::result_cache_options::ResultCacheOptions> result_cache_options = std::shared_ptr<core::result_cache_options::ResultCacheOptions>()
 		)
 			:
 			base_options(base_options),
@@ -62,7 +63,8 @@ namespace mediapipe::tasks::lua::text::language_detector {
 			max_results(max_results),
 			score_threshold(score_threshold),
 			category_allowlist(category_allowlist),
-			category_denylist(category_denylist)
+			category_denylist(category_denylist),
+			result_cache_options(result_cache_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::text::text_classifier::proto::TextClassifierGraphOptions>> to_pb2() const;
@@ -73,6 +75,8 @@ namespace mediapipe::tasks::lua::text::language_detector {
 		CV_PROP_RW std::optional<float> score_threshold;
 		CV_PROP_RW std::vector<std::string> category_allowlist;
 		CV_PROP_RW std::vector<std::string> category_denylist;
+		// Caches the results of recently seen texts, no cache if not set
+		CV_PROP_RW std::shared_ptr<core::result_cache_options::ResultCacheOptions> result_cache_options;
 	};
 
 	class CV_EXPORTS_W LanguageDetector : public ::mediapipe::tasks::lua::text::core::base_text_task_api::BaseTextTaskApi {
@@ -80,10 +84,25 @@ namespace mediapipe::tasks::lua::text::language_detector {
 		using core::base_text_task_api::BaseTextTaskApi::BaseTextTaskApi;
 
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<LanguageDetector>> create(
-			const CalculatorGraphConfig& graph_config
+			const CalculatorGraphConfig& graph_config,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<LanguageDetector>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<LanguageDetector>> create_from_options(std::shared_ptr<LanguageDetectorOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_text_task_api::TextTaskFuture> create_from_options_async(std::shared_ptr<LanguageDetectorOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<LanguageDetectorResult>> detect(const std::string& text);
+		/**
+		 * Runs detect on every text of texts, concurrently on num_workers instances of the graph,
+		 * 4 or the number of hardware threads if lower when num_workers is 0, and returns the results in input order.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status detect_batch(
+			CV_OUT std::vector<std::shared_ptr<LanguageDetectorResult>>& results,
+			const std::vector<std::string>& texts,
+			int num_workers = 0
+		);
+		// Hits, misses and size of the result cache, all zero without result_cache_options
+		CV_WRAP core::result_cache::ResultCacheStats result_cache_stats() const;
+	private:
+		std::unique_ptr<core::result_cache::ResultCache<mediapipe::tasks::components::containers::proto::ClassificationResult>> _result_cache;
 	};
 }
@@ -9,6 +9,8 @@ namespace {
 	using namespace mediapipe::tasks::lua::core::task_info;
 	using namespace mediapipe::lua::packet_getter;
 
+	using ClassificationResultProto = mediapipe::tasks::components::containers::proto::ClassificationResult;
+
 	const std::string _CLASSIFICATIONS_STREAM_NAME = "classifications_out";
 	const std::string _CLASSIFICATIONS_TAG = "CLASSIFICATIONS";
 	const std::string _TEXT_IN_STREAM_NAME = "text_in";
@@ -35,10 +37,11 @@ namespace mediapipe::tasks::lua::text::text_classifier {
 	}
 
 	absl::StatusOr<std::shared_ptr<TextClassifier>> TextClassifier::create(
-		const CalculatorGraphConfig& graph_config
+		const CalculatorGraphConfig& graph_config,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseTextTaskApi = core::base_text_task_api::BaseTextTaskApi;
-		return BaseTextTaskApi::create(graph_config, static_cast<TextClassifier*>(nullptr));
+		return BaseTextTaskApi::create(graph_config, static_cast<TextClassifier*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<TextClassifier>> TextClassifier::create_from_model_path(const std::string& model_path) {
@@ -55,15 +58,56 @@ namespace mediapipe::tasks::lua::text::text_classifier {
 
 		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config());
 
-		return create(*config);
+		MP_ASSIGN_OR_RETURN(auto task, create(*config, options->base_options ? options->base_options->executor : nullptr));
+		if (options->output_compact_categories) {
+			MP_ASSERT_RETURN_IF_ERROR(options->base_options, "base_options must be set to output compact categories");
+			MP_ASSIGN_OR_RETURN(task->_label_tables, components::containers::category::LabelTableCache::CreateFromModel(
+				options->base_options->model_asset_path,
+				options->base_options->model_asset_buffer,
+				options->display_names_locale.value_or("en")
+			));
+		}
+		if (options->result_cache_options) {
+			MP_ASSIGN_OR_RETURN(task->_result_cache, core::result_cache::ResultCache<ClassificationResultProto>::Create(*options->result_cache_options));
+		}
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		return task;
+	}
+
+	std::shared_ptr<core::base_text_task_api::TextTaskFuture> TextClassifier::create_from_options_async(std::shared_ptr<TextClassifierOptions> options) {
+		return std::make_shared<core::base_text_task_api::TextTaskFuture>(options, &TextClassifier::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<TextClassifierResult>> TextClassifier::classify(const std::string& text) {
-		MP_ASSIGN_OR_RETURN(auto output_packets, _runner->Process({
-			{ _TEXT_IN_STREAM_NAME, std::move(MakePacket<std::string>(text)) }
+		MP_ASSIGN_OR_RETURN(auto results, _process_texts_to_results<ClassificationResultProto>(
+			{ text }, _TEXT_IN_STREAM_NAME, _CLASSIFICATIONS_STREAM_NAME, _result_cache.get(), 1,
+			[this](const ClassificationResultProto& classification_result_proto) {
+				return _build_result(classification_result_proto);
 			}));
+		return results[0];
+	}
 
-		MP_PACKET_ASSIGN_OR_RETURN(const auto& classification_result_proto, mediapipe::tasks::components::containers::proto::ClassificationResult, output_packets.at(_CLASSIFICATIONS_STREAM_NAME));
+	absl::Status TextClassifier::classify_batch(
+		std::vector<std::shared_ptr<TextClassifierResult>>& results,
+		const std::vector<std::string>& texts,
+		int num_workers
+	) {
+		MP_ASSIGN_OR_RETURN(results, _process_texts_to_results<ClassificationResultProto>(
+			texts, _TEXT_IN_STREAM_NAME, _CLASSIFICATIONS_STREAM_NAME, _result_cache.get(), num_workers,
+			[this](const ClassificationResultProto& classification_result_proto) {
+				return _build_result(classification_result_proto);
+			}));
+		return absl::OkStatus();
+	}
+
+	core::result_cache::ResultCacheStats TextClassifier::result_cache_stats() const {
+		return _result_cache ? _result_cache->stats() : core::result_cache::ResultCacheStats();
+	}
+
+	absl::StatusOr<std::shared_ptr<TextClassifierResult>> TextClassifier::_build_result(const ClassificationResultProto& classification_result_proto) {
+		if (_label_tables) {
+			return TextClassifierResult::create_from_pb2(classification_result_proto, *_label_tables);
+		}
 		return TextClassifierResult::create_from_pb2(classification_result_proto);
 	}
 }
@@ -21,7 +21,9 @@ namespace mediapipe::tasks::lua::text::text_classifier {
 			const std::optional<int>& max_results = std::nullopt,
 			const std::optional<float>& score_threshold = std::nullopt,
 			const std::vector<std::string>& category_allowlist = std::vector<std::string>(),
-			const std::vector<std::string>& category_denylist = std::vector<std::string>()
+			const std::vector<std::string>& category_denylist = std::vector<std::string>(),
+			bool output_compact_categories = false,
+			std::shared_ptr<core::result_cache_options::ResultCacheOptions> result_cache_options = std::shared_ptr<core::result_cache_options::ResultCacheOptions>()
 		)
 			:
 			base_options(base_options),
@@ -29,7 +31,9 @@ namespace mediapipe::tasks::lua::text::text_classifier {
 			max_results(max_results),
 			score_threshold(score_threshold),
 			category_allowlist(category_allowlist),
-			category_denylist(category_denylist)
+			category_denylist(category_denylist),
+			output_compact_categories(output_compact_categories),
+			result_cache_options(result_cache_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::text::text_classifier::proto::TextClassifierGraphOptions>> to_pb2() const;
@@ -40,6 +44,10 @@ namespace mediapipe::tasks::lua::text::text_classifier {
 		CV_PROP_RW std::optional<float> score_threshold;
 		CV_PROP_RW std::vector<std::string> category_allowlist;
 		CV_PROP_RW std::vector<std::string> category_denylist;
+		// Each head returns its scores as a matrix with a shared label table in compact instead of category objects
+		CV_PROP_RW bool output_compact_categories;
+		// Caches the results of recently seen texts, no cache if not set
+		CV_PROP_RW std::shared_ptr<core::result_cache_options::ResultCacheOptions> result_cache_options;
 	};
 
 	class CV_EXPORTS_W TextClassifier : public ::mediapipe::tasks::lua::text::core::base_text_task_api::BaseTextTaskApi {
@@ -47,10 +55,28 @@ namespace mediapipe::tasks::lua::text::text_classifier {
 		using core::base_text_task_api::BaseTextTaskApi::BaseTextTaskApi;
 
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<TextClassifier>> create(
-			const CalculatorGraphConfig& graph_config
+			const CalculatorGraphConfig& graph_config,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<TextClassifier>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<TextClassifier>> create_from_options(std::shared_ptr<TextClassifierOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_text_task_api::TextTaskFuture> create_from_options_async(std::shared_ptr<TextClassifierOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<TextClassifierResult>> classify(const std::string& text);
+		/**
+		 * Runs classify on every text of texts, concurrently on num_workers instances of the graph,
+		 * 4 or the number of hardware threads if lower when num_workers is 0, and returns the results in input order.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status classify_batch(
+			CV_OUT std::vector<std::shared_ptr<TextClassifierResult>>& results,
+			const std::vector<std::string>& texts,
+			int num_workers = 0
+		);
+		// Hits, misses and size of the result cache, all zero without result_cache_options
+		CV_WRAP core::result_cache::ResultCacheStats result_cache_stats() const;
+	private:
+		[[nodiscard]] absl::StatusOr<std::shared_ptr<TextClassifierResult>> _build_result(const mediapipe::tasks::components::containers::proto::ClassificationResult& classification_result_proto);
+
+		std::shared_ptr<components::containers::category::LabelTableCache> _label_tables;
+		std::unique_ptr<core::result_cache::ResultCache<mediapipe::tasks::components::containers::proto::ClassificationResult>> _result_cache;
 	};
 }
@@ -2,6 +2,7 @@
 #include "binding/tasks/text/text_embedder.h"
 #include "binding/packet_getter.h"
 #include "binding/packet_creator.h"
+#include <cstring>
 
 namespace {
 	using namespace mediapipe::tasks::text::text_embedder::proto;
@@ -11,6 +12,8 @@ namespace {
 	using namespace mediapipe::tasks::lua::components::utils;
 	using namespace mediapipe::lua::packet_getter;
 
+	using EmbeddingResultProto = mediapipe::tasks::components::containers::proto::EmbeddingResult;
+
 	const std::string _EMBEDDINGS_OUT_STREAM_NAME = "embeddings_out";
 	const std::string _EMBEDDINGS_TAG = "EMBEDDINGS";
 	const std::string _TEXT_IN_STREAM_NAME = "text_in";
@@ -33,10 +36,11 @@ namespace mediapipe::tasks::lua::text::text_embedder {
 	}
 
 	absl::StatusOr<std::shared_ptr<TextEmbedder>> TextEmbedder::create(
-		const CalculatorGraphConfig& graph_config
+		const CalculatorGraphConfig& graph_config,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseTextTaskApi = core::base_text_task_api::BaseTextTaskApi;
-		return BaseTextTaskApi::create(graph_config, static_cast<TextEmbedder*>(nullptr));
+		return BaseTextTaskApi::create(graph_config, static_cast<TextEmbedder*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<TextEmbedder>> TextEmbedder::create_from_model_path(const std::string& model_path) {
@@ -53,16 +57,66 @@ namespace mediapipe::tasks::lua::text::text_embedder {
 
 		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config());
 
-		return create(*config);
+		MP_ASSIGN_OR_RETURN(auto task, create(*config, options->base_options ? options->base_options->executor : nullptr));
+		if (options->result_cache_options) {
+			MP_ASSIGN_OR_RETURN(task->_result_cache, core::result_cache::ResultCache<EmbeddingResultProto>::Create(*options->result_cache_options));
+		}
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		return task;
+	}
+
+	std::shared_ptr<core::base_text_task_api::TextTaskFuture> TextEmbedder::create_from_options_async(std::shared_ptr<TextEmbedderOptions> options) {
+		return std::make_shared<core::base_text_task_api::TextTaskFuture>(options, &TextEmbedder::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<TextEmbedderResult>> TextEmbedder::embed(const std::string& text) {
-		MP_ASSIGN_OR_RETURN(auto output_packets, _runner->Process({
-			{ _TEXT_IN_STREAM_NAME, std::move(MakePacket<std::string>(text)) }
+		MP_ASSIGN_OR_RETURN(auto results, _process_texts_to_results<EmbeddingResultProto>(
+			{ text }, _TEXT_IN_STREAM_NAME, _EMBEDDINGS_OUT_STREAM_NAME, _result_cache.get(), 1,
+			[](const EmbeddingResultProto& embedding_result_proto) -> absl::StatusOr<std::shared_ptr<TextEmbedderResult>> {
+				return TextEmbedderResult::create_from_pb2(embedding_result_proto);
+			}));
+		return results[0];
+	}
+
+	absl::Status TextEmbedder::embed_batch(
+		cv::Mat& embeddings,
+		const std::vector<std::string>& texts,
+		int num_workers,
+		int head_index
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(head_index >= 0, "head_index must be greater than or equal to 0");
+
+		MP_ASSIGN_OR_RETURN(auto results, _process_texts_to_results<EmbeddingResultProto>(
+			texts, _TEXT_IN_STREAM_NAME, _EMBEDDINGS_OUT_STREAM_NAME, _result_cache.get(), num_workers,
+			[](const EmbeddingResultProto& embedding_result_proto) -> absl::StatusOr<std::shared_ptr<TextEmbedderResult>> {
+				return TextEmbedderResult::create_from_pb2(embedding_result_proto);
 			}));
 
-		MP_PACKET_ASSIGN_OR_RETURN(const auto& embedding_result_proto, mediapipe::tasks::components::containers::proto::EmbeddingResult, output_packets.at(_EMBEDDINGS_OUT_STREAM_NAME));
-		return TextEmbedderResult::create_from_pb2(embedding_result_proto);
+		embeddings.release();
+
+		for (size_t i = 0; i < results.size(); i++) {
+			MP_ASSERT_RETURN_IF_ERROR(static_cast<size_t>(head_index) < results[i]->embeddings.size(),
+				"head_index " << head_index << " is out of range, the model has " << results[i]->embeddings.size() << " heads");
+
+			// the embedding of a head is a (dimensions x 1) matrix
+			const auto& embedding = results[i]->embeddings[head_index]->embedding;
+
+			if (i == 0) {
+				embeddings.create(static_cast<int>(results.size()), static_cast<int>(embedding.total()), embedding.type());
+			}
+			else {
+				MP_ASSERT_RETURN_IF_ERROR(static_cast<size_t>(embeddings.cols) == embedding.total() && embeddings.type() == embedding.type(),
+					"The embedding of text " << i << " does not have the layout of the previous ones");
+			}
+
+			std::memcpy(embeddings.ptr(static_cast<int>(i)), embedding.data, embedding.total() * embedding.elemSize());
+		}
+
+		return absl::OkStatus();
+	}
+
+	core::result_cache::ResultCacheStats TextEmbedder::result_cache_stats() const {
+		return _result_cache ? _result_cache->stats() : core::result_cache::ResultCacheStats();
 	}
 
 	absl::StatusOr<float> TextEmbedder::cosine_similarity(const Embedding& u, const Embedding& v) {
@@ -19,12 +19,14 @@ namespace mediapipe::tasks::lua::text::text_embedder {
 		CV_WRAP TextEmbedderOptions(
 			std::shared_ptr<lua::core::base_options::BaseOptions> base_options = std::shared_ptr<lua::core::base_options::BaseOptions>(),
 			const std::optional<bool>& l2_normalize = std::nullopt,
-			const std::optional<bool>& quantize = std::nullopt
+			const std::optional<bool>& quantize = std::nullopt,
+			std::shared_ptr<core::result_cache_options::ResultCacheOptions> result_cache_options = std::shared_ptr<core::result_cache_options::ResultCacheOptions>()
 		)
 			:
 			base_options(base_options),
 			l2_normalize(l2_normalize),
-			quantize(quantize)
+			quantize(quantize),
+			result_cache_options(result_cache_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::text::text_embedder::proto::TextEmbedderGraphOptions>> to_pb2() const;
@@ -32,6 +34,8 @@ namespace mediapipe::tasks::lua::text::text_embedder {
 		CV_PROP_RW std::shared_ptr<lua::core::base_options::BaseOptions> base_options;
 		CV_PROP_RW std::optional<bool> l2_normalize;
 		CV_PROP_RW std::optional<bool> quantize;
+		// Caches the results of recently seen texts, no cache if not set
+		CV_PROP_RW std::shared_ptr<core::result_cache_options::ResultCacheOptions> result_cache_options;
 	};
 
 	class CV_EXPORTS_W TextEmbedder : public ::mediapipe::tasks::lua::text::core::base_text_task_api::BaseTextTaskApi {
@@ -39,11 +43,28 @@ namespace mediapipe::tasks::lua::text::text_embedder {
 		using core::base_text_task_api::BaseTextTaskApi::BaseTextTaskApi;
 
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<TextEmbedder>> create(
-			const CalculatorGraphConfig& graph_config
+			const CalculatorGraphConfig& graph_config,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<TextEmbedder>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<TextEmbedder>> create_from_options(std::shared_ptr<TextEmbedderOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_text_task_api::TextTaskFuture> create_from_options_async(std::shared_ptr<TextEmbedderOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<TextEmbedderResult>> embed(const std::string& text);
+		/**
+		 * Runs embed on every text of texts, concurrently on num_workers instances of the graph,
+		 * 4 or the number of hardware threads if lower when num_workers is 0, and returns the embeddings of the head head_index
+		 * as the rows of a (texts x dimensions) matrix, of floats or of bytes when the embeddings are quantized.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status embed_batch(
+			CV_OUT cv::Mat& embeddings,
+			const std::vector<std::string>& texts,
+			int num_workers = 0,
+			int head_index = 0
+		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<float> cosine_similarity(const components::containers::embedding_result::Embedding& u, const components::containers::embedding_result::Embedding& v);
+		// Hits, misses and size of the result cache, all zero without result_cache_options
+		CV_WRAP core::result_cache::ResultCacheStats result_cache_stats() const;
+	private:
+		std::unique_ptr<core::result_cache::ResultCache<mediapipe::tasks::components::containers::proto::EmbeddingResult>> _result_cache;
 	};
 }
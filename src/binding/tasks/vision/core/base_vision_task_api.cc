@@ -1,6 +1,13 @@
+#include "mediapipe/framework/formats/image_frame.h"
+#include "mediapipe/framework/formats/rect.pb.h"
+#include "mediapipe/framework/tool/validate_name.h"
 #include "binding/tasks/vision/core/base_vision_task_api.h"
 #include <lua_bridge_common.hdr.hpp>
 
+namespace {
+	constexpr int _WARMUP_IMAGE_SIZE = 256;
+}
+
 namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 	using vision_task_running_mode::VisionTaskRunningMode;
 	using components::containers::rect::NormalizedRect;
@@ -16,9 +23,10 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 	absl::StatusOr<std::shared_ptr<BaseVisionTaskApi>> BaseVisionTaskApi::create(
 		const CalculatorGraphConfig& graph_config,
 		vision_task_running_mode::VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
-		return create(graph_config, running_mode, std::move(packet_callback), static_cast<BaseVisionTaskApi*>(nullptr));
+		return create(graph_config, running_mode, std::move(packet_callback), static_cast<BaseVisionTaskApi*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::map<std::string, Packet>> BaseVisionTaskApi::_process_image_data(const std::map<std::string, Packet>& inputs) {
@@ -32,7 +40,19 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 		MP_ASSERT_RETURN_IF_ERROR(_running_mode == VisionTaskRunningMode::VIDEO,
 			"Task is not initialized with the video mode. Current running mode: "
 			<< StringifyVisionTaskRunningMode(_running_mode));
-		return _runner->Process(inputs);
+
+		if (!_motion_gate) {
+			return _runner->Process(inputs);
+		}
+
+		MP_ASSIGN_OR_RETURN(auto reused_outputs, _motion_gate->Reuse(inputs));
+		if (reused_outputs) {
+			return *std::move(reused_outputs);
+		}
+
+		MP_ASSIGN_OR_RETURN(auto outputs, _runner->Process(inputs));
+		_motion_gate->Update(outputs);
+		return outputs;
 	}
 
 	absl::Status BaseVisionTaskApi::_send_live_stream_data(const std::map<std::string, Packet>& inputs) {
@@ -91,6 +111,93 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 		return normalized_rect;
 	}
 
+	absl::Status BaseVisionTaskApi::warmup(int num_frames) {
+		// Video and live stream graphs keep tracking state across frames, blank frames would pollute it
+		if (num_frames <= 0 || _running_mode != VisionTaskRunningMode::IMAGE) {
+			return absl::OkStatus();
+		}
+
+		auto image_frame = std::make_shared<ImageFrame>(ImageFormat::SRGB, _WARMUP_IMAGE_SIZE, _WARMUP_IMAGE_SIZE);
+		image_frame->SetToZero();
+		auto image_packet = mediapipe::MakePacket<mediapipe::Image>(image_frame);
+
+		mediapipe::NormalizedRect normalized_rect;
+		normalized_rect.set_x_center(0.5);
+		normalized_rect.set_y_center(0.5);
+		normalized_rect.set_width(1);
+		normalized_rect.set_height(1);
+		auto normalized_rect_packet = mediapipe::MakePacket<mediapipe::NormalizedRect>(std::move(normalized_rect));
+
+		std::map<std::string, Packet> inputs;
+		for (const auto& input_stream : _runner->GetGraphConfig().input_stream()) {
+			std::string tag;
+			std::string name;
+			MP_RETURN_IF_ERROR(mediapipe::tool::ParseTagAndName(input_stream, &tag, &name));
+
+			if (tag == "IMAGE") {
+				inputs[name] = image_packet;
+			}
+			else if (tag == "NORM_RECT") {
+				inputs[name] = normalized_rect_packet;
+			}
+			else {
+				return absl::OkStatus();
+			}
+		}
+
+		for (int i = 0; i < num_frames; i++) {
+			MP_RETURN_IF_ERROR(_runner->Process(inputs).status());
+		}
+
+		return absl::OkStatus();
+	}
+
+	absl::Status BaseVisionTaskApi::set_motion_gate_options(std::shared_ptr<motion_gate_options::MotionGateOptions> options) {
+		if (!options) {
+			_motion_gate.reset();
+			return absl::OkStatus();
+		}
+
+		MP_ASSERT_RETURN_IF_ERROR(_running_mode == VisionTaskRunningMode::VIDEO, "Motion gating is only supported in video mode.");
+		MP_ASSERT_RETURN_IF_ERROR(options->threshold >= 0, "threshold must be greater than or equal to 0");
+		MP_ASSERT_RETURN_IF_ERROR(options->max_skipped_frames >= 0, "max_skipped_frames must be greater than or equal to 0");
+		MP_ASSERT_RETURN_IF_ERROR(options->thumbnail_size > 0, "thumbnail_size must be greater than 0");
+
+		std::string image_stream_name;
+		std::string norm_rect_stream_name;
+		for (const auto& input_stream : _runner->GetGraphConfig().input_stream()) {
+			std::string tag;
+			std::string name;
+			MP_RETURN_IF_ERROR(mediapipe::tool::ParseTagAndName(input_stream, &tag, &name));
+
+			MP_ASSERT_RETURN_IF_ERROR(tag == "IMAGE" || tag == "NORM_RECT", "Motion gating is not supported by tasks with a " << tag << " input.");
+			if (tag == "IMAGE") {
+				image_stream_name = name;
+			}
+			else {
+				norm_rect_stream_name = name;
+			}
+		}
+		MP_ASSERT_RETURN_IF_ERROR(!image_stream_name.empty(), "Motion gating is only supported by tasks with an image input.");
+
+		std::string image_out_stream_name;
+		for (const auto& output_stream : _runner->GetGraphConfig().output_stream()) {
+			std::string tag;
+			std::string name;
+			MP_RETURN_IF_ERROR(mediapipe::tool::ParseTagAndName(output_stream, &tag, &name));
+			if (tag == "IMAGE") {
+				image_out_stream_name = name;
+			}
+		}
+
+		_motion_gate = std::make_unique<motion_gate::MotionGate>(*options, image_stream_name, norm_rect_stream_name, image_out_stream_name);
+		return absl::OkStatus();
+	}
+
+	int64_t BaseVisionTaskApi::get_motion_gate_skipped_frames() const {
+		return _motion_gate ? _motion_gate->skipped_frames() : 0;
+	}
+
 	absl::Status BaseVisionTaskApi::close() {
 		return _runner->Close();
 	}
@@ -98,4 +205,12 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 	std::shared_ptr<mediapipe::CalculatorGraphConfig> BaseVisionTaskApi::get_graph_config() {
 		return ::LUA_MODULE_NAME::reference_internal(_runner->GetGraphConfig());
 	}
+
+	bool VisionTaskFuture::ready() const {
+		return m_future.ready();
+	}
+
+	absl::StatusOr<std::shared_ptr<BaseVisionTaskApi>> VisionTaskFuture::get() {
+		return m_future.get();
+	}
 }
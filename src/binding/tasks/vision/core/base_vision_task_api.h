@@ -4,7 +4,9 @@
 #include "mediapipe/framework/formats/image.h"
 #include "mediapipe/framework/port/status_macros.h"
 #include "binding/tasks/vision/core/image_processing_options.h"
+#include "binding/tasks/vision/core/motion_gate.h"
 #include "binding/tasks/vision/core/vision_task_running_mode.h"
+#include "binding/tasks/core/task_future.h"
 #include "binding/tasks/core/task_runner.h"
 #include "binding/tasks/components/containers/rect.h"
 #include <cmath>
@@ -19,7 +21,8 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 			const CalculatorGraphConfig& graph_config,
 			vision_task_running_mode::VisionTaskRunningMode running_mode,
 			mediapipe::lua::PacketsCallback&& packet_callback,
-			_Tp*
+			_Tp*,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		) {
 			if (running_mode == vision_task_running_mode::VisionTaskRunningMode::LIVE_STREAM) {
 				MP_ASSERT_RETURN_IF_ERROR(packet_callback, "The vision task is in live stream mode, a user-defined result "
@@ -30,7 +33,7 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 					"callback should not be provided.");
 			}
 
-			MP_ASSIGN_OR_RETURN(auto runner, mediapipe::lua::task_runner::create(graph_config, std::move(packet_callback)));
+			MP_ASSIGN_OR_RETURN(auto runner, mediapipe::lua::task_runner::create(graph_config, std::move(packet_callback), executor));
 			return std::make_shared<_Tp>(runner, running_mode);
 		}
 
@@ -42,7 +45,8 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<BaseVisionTaskApi>> create(
 			const CalculatorGraphConfig& graph_config,
 			vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::map<std::string, Packet>> _process_image_data(const std::map<std::string, Packet>& inputs);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::map<std::string, Packet>> _process_video_data(const std::map<std::string, Packet>& inputs);
@@ -52,10 +56,49 @@ namespace mediapipe::tasks::lua::vision::core::base_vision_task_api {
 			const mediapipe::Image& image,
 			bool roi_allowed = true
 		);
+		/**
+		 * Runs num_frames blank frames through the task, so that tensor allocation and weight packing
+		 * happen before the first real frame.
+		 * Only image mode tasks are warmed up, blank frames would pollute the tracking state of video and
+		 * live stream graphs. Tasks with other inputs than an image and a normalized rect are not warmed up either.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status warmup(int num_frames = 1);
+		/**
+		 * Skips the video frames nearly identical to the last processed frame, _process_video_data returns
+		 * the outputs of that frame instead. Passing nothing disables the gate.
+		 * Only video mode tasks with an image input, and optionally a normalized rect input, can be gated.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status set_motion_gate_options(
+			std::shared_ptr<motion_gate_options::MotionGateOptions> options =
+			std::shared_ptr<motion_gate_options::MotionGateOptions>()
+		);
+		// Number of video frames skipped by the motion gate since its options were last set, 0 without gate
+		CV_WRAP int64_t get_motion_gate_skipped_frames() const;
 		CV_WRAP [[nodiscard]] absl::Status close();
 		CV_WRAP std::shared_ptr<mediapipe::CalculatorGraphConfig> get_graph_config();
 	protected:
 		std::shared_ptr<mediapipe::tasks::core::TaskRunner> _runner;
 		vision_task_running_mode::VisionTaskRunningMode _running_mode;
+		std::unique_ptr<motion_gate::MotionGate> _motion_gate;
+	};
+
+	// A vision task being created in the background by create_from_options_async
+	class CV_EXPORTS_W VisionTaskFuture {
+	public:
+		template<typename _Options, typename _Tp>
+		VisionTaskFuture(
+			const std::shared_ptr<_Options>& options,
+			absl::StatusOr<std::shared_ptr<_Tp>>(*create_from_options)(std::shared_ptr<_Options>)
+		) : m_future([options, create_from_options]() -> absl::StatusOr<std::shared_ptr<BaseVisionTaskApi>> {
+			return create_from_options(options);
+		}, options) {}
+
+		// Whether get returns without waiting
+		CV_WRAP bool ready() const;
+
+		// Waits for the task to be created and returns it
+		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<BaseVisionTaskApi>> get();
+	private:
+		mediapipe::tasks::lua::core::task_future::TaskFuture<BaseVisionTaskApi> m_future;
 	};
 }
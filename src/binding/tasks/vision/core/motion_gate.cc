@@ -0,0 +1,81 @@
+#include "mediapipe/framework/formats/image.h"
+#include "mediapipe/framework/formats/image_frame_opencv.h"
+#include "mediapipe/framework/formats/rect.pb.h"
+#include "mediapipe/framework/port/status_macros.h"
+#include "binding/tasks/vision/core/motion_gate.h"
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace mediapipe::tasks::lua::vision::core::motion_gate {
+	absl::StatusOr<std::optional<std::map<std::string, Packet>>> MotionGate::Reuse(const std::map<std::string, Packet>& inputs) {
+		m_candidate_thumbnail.release();
+		m_candidate_norm_rect.clear();
+
+		const auto& image_packet = inputs.at(m_image_stream_name);
+		MP_RETURN_IF_ERROR(image_packet.ValidateAsType<mediapipe::Image>());
+		const auto& image = image_packet.Get<mediapipe::Image>();
+
+		const auto image_frame = image.GetImageFrameSharedPtr();
+		if (!image_frame) {
+			return std::nullopt;
+		}
+
+		m_candidate_frame_size = cv::Size(image_frame->Width(), image_frame->Height());
+		cv::resize(
+			formats::MatView(image_frame.get()),
+			m_candidate_thumbnail,
+			cv::Size(m_options.thumbnail_size, m_options.thumbnail_size),
+			0, 0,
+			cv::INTER_AREA
+		);
+
+		if (!m_norm_rect_stream_name.empty()) {
+			const auto& norm_rect_packet = inputs.at(m_norm_rect_stream_name);
+			MP_RETURN_IF_ERROR(norm_rect_packet.ValidateAsType<mediapipe::NormalizedRect>());
+			m_candidate_norm_rect = norm_rect_packet.Get<mediapipe::NormalizedRect>().SerializeAsString();
+		}
+
+		if (
+			m_outputs.empty()
+			|| m_skipped_frames >= m_options.max_skipped_frames
+			|| m_candidate_frame_size != m_frame_size
+			|| m_candidate_thumbnail.type() != m_thumbnail.type()
+			|| m_candidate_norm_rect != m_norm_rect
+			) {
+			return std::nullopt;
+		}
+
+		const double difference = cv::norm(m_candidate_thumbnail, m_thumbnail, cv::NORM_L1) / (m_thumbnail.total() * m_thumbnail.channels());
+		if (difference >= m_options.threshold) {
+			return std::nullopt;
+		}
+
+		m_skipped_frames++;
+		m_total_skipped_frames++;
+
+		const auto timestamp = image_packet.Timestamp();
+		std::map<std::string, Packet> outputs;
+		for (const auto& [name, packet] : m_outputs) {
+			if (name == m_image_out_stream_name) {
+				outputs[name] = image_packet;
+			}
+			else {
+				outputs[name] = packet.IsEmpty() ? packet : packet.At(timestamp);
+			}
+		}
+		return outputs;
+	}
+
+	void MotionGate::Update(const std::map<std::string, Packet>& outputs) {
+		if (m_candidate_thumbnail.empty()) {
+			m_outputs.clear();
+			return;
+		}
+
+		m_frame_size = m_candidate_frame_size;
+		cv::swap(m_thumbnail, m_candidate_thumbnail);
+		m_norm_rect.swap(m_candidate_norm_rect);
+		m_outputs = outputs;
+		m_skipped_frames = 0;
+	}
+}
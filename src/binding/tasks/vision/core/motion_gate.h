@@ -0,0 +1,62 @@
+#pragma once
+
+#include "mediapipe/framework/packet.h"
+#include "absl/status/statusor.h"
+#include "binding/tasks/vision/core/motion_gate_options.h"
+#include <map>
+#include <optional>
+#include <opencv2/core/mat.hpp>
+#include <string>
+
+namespace mediapipe::tasks::lua::vision::core::motion_gate {
+	// Skips the video frames that are nearly identical to the last processed frame.
+	//
+	// Frames are compared on a downsampled thumbnail, the other input, if any, must be a NORM_RECT equal to the
+	// one of the last processed frame.
+	// The image output, if any, is the skipped frame itself, not the image of the last processed frame.
+	class MotionGate {
+	public:
+		MotionGate(
+			const motion_gate_options::MotionGateOptions& options,
+			const std::string& image_stream_name,
+			const std::string& norm_rect_stream_name,
+			const std::string& image_out_stream_name
+		) :
+			m_options(options),
+			m_image_stream_name(image_stream_name),
+			m_norm_rect_stream_name(norm_rect_stream_name),
+			m_image_out_stream_name(image_out_stream_name)
+		{}
+
+		// Returns the outputs of the last processed frame at the timestamp of inputs,
+		// or nothing if inputs must be processed, in which case Update must be called with their outputs
+		[[nodiscard]] absl::StatusOr<std::optional<std::map<std::string, Packet>>> Reuse(const std::map<std::string, Packet>& inputs);
+
+		// Makes the frame of the last call to Reuse the reference frame
+		void Update(const std::map<std::string, Packet>& outputs);
+
+		// Number of frames skipped since the gate was created
+		int64_t skipped_frames() const {
+			return m_total_skipped_frames;
+		}
+
+	private:
+		motion_gate_options::MotionGateOptions m_options;
+		std::string m_image_stream_name;
+		std::string m_norm_rect_stream_name;
+		std::string m_image_out_stream_name;
+		int64_t m_total_skipped_frames = 0;
+
+		// last processed frame
+		cv::Size m_frame_size;
+		cv::Mat m_thumbnail;
+		std::string m_norm_rect;
+		std::map<std::string, Packet> m_outputs;
+		int m_skipped_frames = 0;
+
+		// frame of the last call to Reuse
+		cv::Size m_candidate_frame_size;
+		cv::Mat m_candidate_thumbnail;
+		std::string m_candidate_norm_rect;
+	};
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <opencv2/core/cvdef.h>
+
+namespace mediapipe::tasks::lua::vision::core::motion_gate_options {
+	/**
+	 * Options of the motion gate of video mode tasks.
+	 * Frames whose thumbnail barely differs from the thumbnail of the last processed frame are not run
+	 * through the graph, the results of the last processed frame are returned instead.
+	 */
+	struct CV_EXPORTS_W_SIMPLE MotionGateOptions {
+		CV_WRAP MotionGateOptions(const MotionGateOptions& other) = default;
+		MotionGateOptions& operator=(const MotionGateOptions& other) = default;
+
+		CV_WRAP MotionGateOptions(
+			float threshold = 2.0f,
+			int max_skipped_frames = 5,
+			int thumbnail_size = 32
+		) : threshold(threshold), max_skipped_frames(max_skipped_frames), thumbnail_size(thumbnail_size) {}
+
+		// Mean absolute difference of the thumbnails, in pixel values, below which a frame is skipped
+		CV_PROP_RW float threshold;
+		// Number of consecutive frames that can reuse the results of a processed frame
+		CV_PROP_RW int max_skipped_frames;
+		// Width and height of the thumbnails frames are compared on
+		CV_PROP_RW int thumbnail_size;
+	};
+}
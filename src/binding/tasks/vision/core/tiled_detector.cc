@@ -0,0 +1,228 @@
+#include "mediapipe/framework/formats/rect.pb.h"
+#include "binding/tasks/vision/core/tiled_detector.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+	using mediapipe::Detection;
+	using mediapipe::LocationData;
+
+	// Start offsets of the tiles along an axis, the last tile ends on the frame border
+	std::vector<int> GetTileOffsets(int length, int tile_length, float overlap) {
+		const int stride = std::max(1, static_cast<int>(tile_length * (1.0f - overlap)));
+
+		std::vector<int> offsets;
+		for (int offset = 0; ; offset += stride) {
+			if (offset + tile_length >= length) {
+				offsets.push_back(length - tile_length);
+				break;
+			}
+			offsets.push_back(offset);
+		}
+
+		return offsets;
+	}
+
+	float GetScore(const Detection& detection) {
+		return detection.score_size() != 0 ? detection.score(0) : 0.0f;
+	}
+
+	// Detections are only suppressed by detections of the same label
+	std::string GetLabel(const Detection& detection) {
+		if (detection.label_size() != 0) {
+			return detection.label(0);
+		}
+		return std::to_string(detection.label_id_size() != 0 ? detection.label_id(0) : -1);
+	}
+
+	float IntersectionOverUnion(const LocationData::BoundingBox& a, const LocationData::BoundingBox& b) {
+		const int left = std::max(a.xmin(), b.xmin());
+		const int top = std::max(a.ymin(), b.ymin());
+		const int right = std::min(a.xmin() + a.width(), b.xmin() + b.width());
+		const int bottom = std::min(a.ymin() + a.height(), b.ymin() + b.height());
+
+		if (right <= left || bottom <= top) {
+			return 0.0f;
+		}
+
+		const float intersection = static_cast<float>(right - left) * (bottom - top);
+		const float area_union = static_cast<float>(a.width()) * a.height() + static_cast<float>(b.width()) * b.height() - intersection;
+		return area_union > 0 ? intersection / area_union : 0.0f;
+	}
+
+	// Returns the kept detections by decreasing score, at most max_results of them if max_results is not negative
+	std::vector<Detection> NonMaxSuppression(std::vector<Detection>&& detections, float iou_threshold, int max_results) {
+		std::vector<size_t> order(detections.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&detections](size_t i, size_t j) {
+			return GetScore(detections[i]) > GetScore(detections[j]);
+		});
+
+		std::vector<Detection> kept;
+		std::vector<std::string> kept_labels;
+
+		for (const auto i : order) {
+			if (max_results >= 0 && kept.size() >= static_cast<size_t>(max_results)) {
+				break;
+			}
+
+			auto& detection = detections[i];
+			auto label = GetLabel(detection);
+
+			bool suppressed = false;
+			for (size_t k = 0; k < kept.size() && !suppressed; k++) {
+				suppressed = kept_labels[k] == label && IntersectionOverUnion(
+					kept[k].location_data().bounding_box(),
+					detection.location_data().bounding_box()
+				) > iou_threshold;
+			}
+
+			if (!suppressed) {
+				kept.push_back(std::move(detection));
+				kept_labels.push_back(std::move(label));
+			}
+		}
+
+		return kept;
+	}
+}
+
+namespace mediapipe::tasks::lua::vision::core::tiled_detector {
+	using base_vision_task_api::BaseVisionTaskApi;
+	using mediapipe::lua::instance_pool::DispatchPolicy;
+	using mediapipe::lua::instance_pool::InstancePool;
+	using tiling_options::TilingOptions;
+
+	TiledDetector::TiledDetector(
+		const std::vector<std::shared_ptr<BaseVisionTaskApi>>& workers,
+		const TilingOptions& options,
+		int max_results,
+		const std::string& image_stream_name,
+		const std::string& norm_rect_stream_name,
+		const std::string& detections_stream_name
+	) :
+		m_options(options),
+		m_max_results(max_results),
+		m_image_stream_name(image_stream_name),
+		m_norm_rect_stream_name(norm_rect_stream_name),
+		m_detections_stream_name(detections_stream_name)
+	{
+		m_pool = std::make_unique<InstancePool<BaseVisionTaskApi, PacketMap, PacketMap>>(
+			workers,
+			[](BaseVisionTaskApi& task, PacketMap&& inputs) {
+				return task._process_image_data(inputs);
+			},
+			DispatchPolicy::LEAST_LOADED
+		);
+	}
+
+	absl::StatusOr<std::shared_ptr<TiledDetector>> TiledDetector::Create(
+		const CalculatorGraphConfig& graph_config,
+		const TilingOptions& options,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor,
+		int warmup_frames,
+		int max_results,
+		const std::string& image_stream_name,
+		const std::string& norm_rect_stream_name,
+		const std::string& detections_stream_name
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(options.tile_size > 0, "tile_size must be greater than 0");
+		MP_ASSERT_RETURN_IF_ERROR(options.overlap >= 0 && options.overlap < 1, "overlap must be in [0, 1)");
+		MP_ASSERT_RETURN_IF_ERROR(options.num_workers >= 1, "num_workers must be greater than 0");
+		MP_ASSERT_RETURN_IF_ERROR(options.iou_threshold > 0 && options.iou_threshold <= 1, "iou_threshold must be in (0, 1]");
+
+		std::vector<std::shared_ptr<BaseVisionTaskApi>> workers;
+		workers.reserve(options.num_workers);
+		for (int i = 0; i < options.num_workers; i++) {
+			MP_ASSIGN_OR_RETURN(auto worker, BaseVisionTaskApi::create(graph_config, vision_task_running_mode::VisionTaskRunningMode::IMAGE, nullptr, executor));
+			MP_RETURN_IF_ERROR(worker->warmup(warmup_frames));
+			workers.push_back(std::move(worker));
+		}
+
+		return std::make_shared<TiledDetector>(workers, options, max_results, image_stream_name, norm_rect_stream_name, detections_stream_name);
+	}
+
+	std::vector<cv::Rect> TiledDetector::GetTiles(int width, int height) const {
+		const int tile_width = std::min(m_options.tile_size, width);
+		const int tile_height = std::min(m_options.tile_size, height);
+
+		const auto xs = GetTileOffsets(width, tile_width, m_options.overlap);
+		const auto ys = GetTileOffsets(height, tile_height, m_options.overlap);
+
+		std::vector<cv::Rect> tiles;
+		tiles.reserve(xs.size() * ys.size() + 1);
+		for (const auto y : ys) {
+			for (const auto x : xs) {
+				tiles.emplace_back(x, y, tile_width, tile_height);
+			}
+		}
+
+		if (m_options.include_full_frame && tiles.size() > 1) {
+			tiles.emplace_back(0, 0, width, height);
+		}
+
+		return tiles;
+	}
+
+	absl::StatusOr<std::vector<mediapipe::Detection>> TiledDetector::Detect(
+		const mediapipe::Image& image,
+		std::shared_ptr<image_processing_options::ImageProcessingOptions> image_processing_options
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(!image_processing_options
+			|| (!image_processing_options->region_of_interest && image_processing_options->rotation_degrees == 0),
+			"Tiled detection doesn't support region-of-interest nor rotation.");
+
+		const int width = image.width();
+		const int height = image.height();
+
+		// every tile shares the pixels of the frame
+		const auto image_packet = mediapipe::MakePacket<mediapipe::Image>(image);
+
+		const auto tiles = GetTiles(width, height);
+		std::vector<PacketMap> requests;
+		requests.reserve(tiles.size());
+
+		for (const auto& tile : tiles) {
+			mediapipe::NormalizedRect normalized_rect;
+			normalized_rect.set_x_center((tile.x + tile.width / 2.0f) / width);
+			normalized_rect.set_y_center((tile.y + tile.height / 2.0f) / height);
+			normalized_rect.set_width(static_cast<float>(tile.width) / width);
+			normalized_rect.set_height(static_cast<float>(tile.height) / height);
+			normalized_rect.set_rotation(0);
+
+			requests.push_back({
+				{ m_image_stream_name, image_packet },
+				{ m_norm_rect_stream_name, mediapipe::MakePacket<mediapipe::NormalizedRect>(std::move(normalized_rect)) },
+			});
+		}
+
+		MP_ASSIGN_OR_RETURN(auto responses, m_pool->ProcessAll(std::move(requests)));
+
+		std::vector<mediapipe::Detection> detections;
+		for (const auto& response : responses) {
+			const auto& packet = response.at(m_detections_stream_name);
+			if (packet.IsEmpty()) {
+				continue;
+			}
+
+			MP_RETURN_IF_ERROR(packet.ValidateAsType<std::vector<mediapipe::Detection>>());
+			const auto& tile_detections = packet.Get<std::vector<mediapipe::Detection>>();
+			detections.insert(detections.end(), tile_detections.begin(), tile_detections.end());
+		}
+
+		return NonMaxSuppression(std::move(detections), m_options.iou_threshold, m_max_results);
+	}
+
+	absl::StatusOr<std::vector<mediapipe::Detection>> TiledDetector::DetectForVideo(
+		const mediapipe::Image& image,
+		int64_t timestamp_ms,
+		std::shared_ptr<image_processing_options::ImageProcessingOptions> image_processing_options
+	) {
+		// the tiles run on image mode instances, which do not check the timestamps
+		MP_ASSERT_RETURN_IF_ERROR(!m_last_timestamp_ms || timestamp_ms > *m_last_timestamp_ms,
+			"Input timestamp must be monotonically increasing.");
+		m_last_timestamp_ms = timestamp_ms;
+
+		return Detect(image, image_processing_options);
+	}
+}
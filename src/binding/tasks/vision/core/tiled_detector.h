@@ -0,0 +1,65 @@
+#pragma once
+
+#include "mediapipe/framework/formats/detection.pb.h"
+#include "binding/instance_pool.h"
+#include "binding/tasks/vision/core/base_vision_task_api.h"
+#include "binding/tasks/vision/core/tiling_options.h"
+#include <opencv2/core/types.hpp>
+#include <optional>
+
+namespace mediapipe::tasks::lua::vision::core::tiled_detector {
+	// Runs a detection graph on the overlapping tiles of a frame, in parallel on image mode instances of the graph,
+	// and merges the detections of the tiles in frame coordinates, best scores first, at most max_results of them.
+	//
+	// Tiles are sent as the NORM_RECT of the graph, which projects the detections back to the whole frame.
+	class TiledDetector {
+	public:
+		TiledDetector(
+			const std::vector<std::shared_ptr<base_vision_task_api::BaseVisionTaskApi>>& workers,
+			const tiling_options::TilingOptions& options,
+			int max_results,
+			const std::string& image_stream_name,
+			const std::string& norm_rect_stream_name,
+			const std::string& detections_stream_name
+		);
+
+		// Creates options.num_workers instances of graph_config, warmed up with warmup_frames
+		[[nodiscard]] static absl::StatusOr<std::shared_ptr<TiledDetector>> Create(
+			const CalculatorGraphConfig& graph_config,
+			const tiling_options::TilingOptions& options,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor,
+			int warmup_frames,
+			int max_results,
+			const std::string& image_stream_name,
+			const std::string& norm_rect_stream_name,
+			const std::string& detections_stream_name
+		);
+
+		// Tiles of a width x height frame, in pixels
+		std::vector<cv::Rect> GetTiles(int width, int height) const;
+
+		[[nodiscard]] absl::StatusOr<std::vector<mediapipe::Detection>> Detect(
+			const mediapipe::Image& image,
+			std::shared_ptr<image_processing_options::ImageProcessingOptions> image_processing_options
+		);
+
+		// Detect for the frames of a video, whose timestamps must be monotonically increasing
+		[[nodiscard]] absl::StatusOr<std::vector<mediapipe::Detection>> DetectForVideo(
+			const mediapipe::Image& image,
+			int64_t timestamp_ms,
+			std::shared_ptr<image_processing_options::ImageProcessingOptions> image_processing_options
+		);
+
+	private:
+		using PacketMap = std::map<std::string, Packet>;
+
+		tiling_options::TilingOptions m_options;
+		// negative for no limit
+		int m_max_results;
+		std::optional<int64_t> m_last_timestamp_ms;
+		std::string m_image_stream_name;
+		std::string m_norm_rect_stream_name;
+		std::string m_detections_stream_name;
+		std::unique_ptr<mediapipe::lua::instance_pool::InstancePool<base_vision_task_api::BaseVisionTaskApi, PacketMap, PacketMap>> m_pool;
+	};
+}
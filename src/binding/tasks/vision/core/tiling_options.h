@@ -0,0 +1,40 @@
+#pragma once
+
+#include <opencv2/core/cvdef.h>
+
+namespace mediapipe::tasks::lua::vision::core::tiling_options {
+	/**
+	 * Options of the tiled inference of detection tasks.
+	 * Frames are split into overlapping tiles, each tile is run through one of num_workers task instances,
+	 * and the detections of all the tiles are merged with a non maximum suppression.
+	 */
+	struct CV_EXPORTS_W_SIMPLE TilingOptions {
+		CV_WRAP TilingOptions(const TilingOptions& other) = default;
+		TilingOptions& operator=(const TilingOptions& other) = default;
+
+		CV_WRAP TilingOptions(
+			int tile_size = 640,
+			float overlap = 0.2f,
+			int num_workers = 2,
+			float iou_threshold = 0.5f,
+			bool include_full_frame = true
+		) :
+			tile_size(tile_size),
+			overlap(overlap),
+			num_workers(num_workers),
+			iou_threshold(iou_threshold),
+			include_full_frame(include_full_frame)
+		{}
+
+		// Width and height of the tiles in pixels
+		CV_PROP_RW int tile_size;
+		// Fraction of a tile shared with its neighbours, in [0, 1)
+		CV_PROP_RW float overlap;
+		// Number of task instances running tiles in parallel
+		CV_PROP_RW int num_workers;
+		// Detections of the same label overlapping more than this intersection over union are merged
+		CV_PROP_RW float iou_threshold;
+		// Also runs the whole frame, for objects larger than a tile
+		CV_PROP_RW bool include_full_frame;
+	};
+}
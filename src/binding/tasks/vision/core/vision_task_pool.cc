@@ -0,0 +1,80 @@
+#include "binding/tasks/vision/core/vision_task_pool.h"
+
+namespace mediapipe::tasks::lua::vision::core::vision_task_pool {
+	using base_vision_task_api::BaseVisionTaskApi;
+	using mediapipe::lua::instance_pool::DispatchPolicy;
+	using mediapipe::lua::instance_pool::InstancePool;
+
+	VisionTaskPool::VisionTaskPool(
+		const std::vector<std::shared_ptr<BaseVisionTaskApi>>& tasks,
+		DispatchPolicy dispatch_policy
+	) {
+		m_pool = std::make_unique<InstancePool<BaseVisionTaskApi, PacketMap, PacketMap>>(
+			tasks,
+			[](BaseVisionTaskApi& task, PacketMap&& inputs) {
+				return task._process_image_data(inputs);
+			},
+			dispatch_policy
+		);
+	}
+
+	absl::StatusOr<std::shared_ptr<VisionTaskPool>> VisionTaskPool::create(
+		const CalculatorGraphConfig& graph_config,
+		int num_instances,
+		DispatchPolicy dispatch_policy
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(num_instances >= 1, "num_instances must be greater than 0");
+
+		std::vector<std::shared_ptr<BaseVisionTaskApi>> tasks;
+		tasks.reserve(num_instances);
+		for (int i = 0; i < num_instances; i++) {
+			MP_ASSIGN_OR_RETURN(auto task, BaseVisionTaskApi::create(graph_config, vision_task_running_mode::VisionTaskRunningMode::IMAGE));
+			tasks.push_back(std::move(task));
+		}
+
+		return std::make_shared<VisionTaskPool>(tasks, dispatch_policy);
+	}
+
+	absl::StatusOr<std::shared_ptr<VisionTaskPool>> VisionTaskPool::create(
+		const std::vector<std::shared_ptr<BaseVisionTaskApi>>& tasks,
+		DispatchPolicy dispatch_policy
+	) {
+		MP_ASSERT_RETURN_IF_ERROR(!tasks.empty(), "At least one task is required");
+		for (const auto& task : tasks) {
+			MP_ASSERT_RETURN_IF_ERROR(static_cast<bool>(task), "task cannot be None");
+		}
+		return std::make_shared<VisionTaskPool>(tasks, dispatch_policy);
+	}
+
+	absl::StatusOr<int64_t> VisionTaskPool::submit(const std::map<std::string, Packet>& inputs) {
+		return m_pool->Enqueue(m_pool->Dispatch(), PacketMap(inputs));
+	}
+
+	absl::StatusOr<bool> VisionTaskPool::poll(
+		std::map<std::string, Packet>& outputs,
+		int64_t& request_id,
+		bool block
+	) {
+		absl::StatusOr<PacketMap> response;
+		if (!m_pool->Poll(request_id, response, block)) {
+			return false;
+		}
+
+		MP_RETURN_IF_ERROR(response.status());
+		outputs = std::move(*response);
+		return true;
+	}
+
+	absl::Status VisionTaskPool::drain(std::vector<std::map<std::string, Packet>>& outputs) {
+		outputs.clear();
+		outputs.reserve(m_pool->pending());
+
+		int64_t request_id;
+		while (m_pool->pending() != 0) {
+			MP_ASSIGN_OR_RETURN(auto polled, poll(outputs.emplace_back(), request_id, true));
+			MP_ASSERT_RETURN_IF_ERROR(polled, "Expecting the outputs of a pending request");
+		}
+
+		return absl::OkStatus();
+	}
+}
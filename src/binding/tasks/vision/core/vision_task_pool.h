@@ -0,0 +1,77 @@
+#pragma once
+
+#include "binding/instance_pool.h"
+#include "binding/tasks/vision/core/base_vision_task_api.h"
+
+namespace mediapipe::tasks::lua::vision::core::vision_task_pool {
+	/**
+	 * Shards image mode requests across independent vision tasks, each one driven by its own native worker thread.
+	 *
+	 * Requests and responses are the packet maps of BaseVisionTaskApi::_process_image_data,
+	 * typed results are built by each task from its own output streams and settings, the pool cannot build them.
+	 * Pooled tasks must not be used directly anymore.
+	 */
+	class CV_EXPORTS_W VisionTaskPool {
+	public:
+		VisionTaskPool(
+			const std::vector<std::shared_ptr<base_vision_task_api::BaseVisionTaskApi>>& tasks,
+			mediapipe::lua::instance_pool::DispatchPolicy dispatch_policy
+		);
+
+		/**
+		 * Creates num_instances tasks in image mode from the same graph config.
+		 */
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<VisionTaskPool>> create(
+			const CalculatorGraphConfig& graph_config,
+			int num_instances,
+			mediapipe::lua::instance_pool::DispatchPolicy dispatch_policy = mediapipe::lua::instance_pool::DispatchPolicy::ROUND_ROBIN
+		);
+
+		/**
+		 * Pools tasks created in image mode with the same options.
+		 */
+		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<VisionTaskPool>> create(
+			const std::vector<std::shared_ptr<base_vision_task_api::BaseVisionTaskApi>>& tasks,
+			mediapipe::lua::instance_pool::DispatchPolicy dispatch_policy = mediapipe::lua::instance_pool::DispatchPolicy::ROUND_ROBIN
+		);
+
+		/**
+		 * Queues a request on one of the tasks.
+		 *
+		 *  Returns:
+		 *    the request id, ids are increasing in submission order.
+		 */
+		CV_WRAP [[nodiscard]] absl::StatusOr<int64_t> submit(const std::map<std::string, Packet>& inputs);
+
+		/**
+		 * Retrieves the output packets of the oldest submitted request.
+		 *
+		 *  Returns:
+		 *    true if outputs and request_id have been filled, false if the oldest request
+		 *    is not processed yet or if there is no submitted request.
+		 */
+		CV_WRAP [[nodiscard]] absl::StatusOr<bool> poll(
+			CV_OUT std::map<std::string, Packet>& outputs,
+			CV_OUT int64_t& request_id,
+			bool block = false
+		);
+
+		/**
+		 * Waits for all the submitted requests and retrieves their output packets in submission order.
+		 */
+		CV_WRAP [[nodiscard]] absl::Status drain(CV_OUT std::vector<std::map<std::string, Packet>>& outputs);
+
+		CV_WRAP size_t get_num_instances() const {
+			return m_pool->size();
+		}
+
+		CV_WRAP int64_t get_num_pending() const {
+			return m_pool->pending();
+		}
+
+	private:
+		using PacketMap = std::map<std::string, Packet>;
+
+		std::unique_ptr<mediapipe::lua::instance_pool::InstancePool<base_vision_task_api::BaseVisionTaskApi, PacketMap, PacketMap>> m_pool;
+	};
+}
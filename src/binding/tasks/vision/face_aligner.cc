@@ -38,10 +38,11 @@ namespace mediapipe::tasks::lua::vision::face_aligner {
 	absl::StatusOr<std::shared_ptr<FaceAligner>> FaceAligner::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<FaceAligner*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<FaceAligner*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<FaceAligner>> FaceAligner::create_from_model_path(const std::string& model_path) {
@@ -64,11 +65,18 @@ namespace mediapipe::tasks::lua::vision::face_aligner {
 
 		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(false));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			VisionTaskRunningMode::IMAGE,
-			nullptr
-		);
+			nullptr,
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> FaceAligner::create_from_options_async(std::shared_ptr<FaceAlignerOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &FaceAligner::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<Image>> FaceAligner::align(
@@ -78,7 +86,7 @@ namespace mediapipe::tasks::lua::vision::face_aligner {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
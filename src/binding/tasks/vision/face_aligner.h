@@ -35,10 +35,12 @@ namespace mediapipe::tasks::lua::vision::face_aligner {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceAligner>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceAligner>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceAligner>> create_from_options(std::shared_ptr<FaceAlignerOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<FaceAlignerOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<Image>> align(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options =
@@ -6,6 +6,7 @@
 #include "binding/tasks/core/task_info.h"
 #include "binding/tasks/vision/core/base_vision_task_api.h"
 #include "binding/tasks/vision/core/image_processing_options.h"
+#include "binding/tasks/vision/core/tiled_detector.h"
 #include "binding/tasks/vision/core/vision_task_running_mode.h"
 #include "binding/packet_getter.h"
 #include "binding/packet_creator.h"
@@ -24,14 +25,22 @@ namespace mediapipe::tasks::lua::vision::face_detector {
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode = tasks::lua::vision::core::vision_task_running_mode::VisionTaskRunningMode::IMAGE,
 			const std::optional<float>& min_detection_confidence = std::nullopt,
 			const std::optional<float>& min_suppression_threshold = std::nullopt,
-			FaceDetectorResultCallback result_callback = nullptr
+			FaceDetectorResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			bool output_dense_detections = false,
+			std::shared_ptr<core::tiling_options::TilingOptions> tiling_options = std::shared_ptr<core::tiling_options::TilingOptions>(),
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		)
 			:
 			base_options(base_options),
 			running_mode(running_mode),
 			min_detection_confidence(min_detection_confidence),
 			min_suppression_threshold(min_suppression_threshold),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			output_dense_detections(output_dense_detections),
+			tiling_options(tiling_options),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::face_detector::proto::FaceDetectorGraphOptions>> to_pb2() const;
@@ -41,6 +50,13 @@ namespace mediapipe::tasks::lua::vision::face_detector {
 		CV_PROP_RW std::optional<float> min_detection_confidence;
 		CV_PROP_RW std::optional<float> min_suppression_threshold;
 		CV_PROP_W  FaceDetectorResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Detections are returned as matrices in dense instead of objects
+		CV_PROP_RW bool output_dense_detections;
+		// Frames are split into tiles run in parallel when set, for small objects in large frames
+		CV_PROP_RW std::shared_ptr<core::tiling_options::TilingOptions> tiling_options;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W FaceDetector : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -50,10 +66,12 @@ namespace mediapipe::tasks::lua::vision::face_detector {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceDetector>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceDetector>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceDetector>> create_from_options(std::shared_ptr<FaceDetectorOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<FaceDetectorOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<FaceDetectorResult>> detect(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options =
@@ -71,5 +89,8 @@ namespace mediapipe::tasks::lua::vision::face_detector {
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options =
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
 		);
+	private:
+		bool _output_dense_detections = false;
+		std::shared_ptr<core::tiled_detector::TiledDetector> _tiled_detector;
 	};
 }
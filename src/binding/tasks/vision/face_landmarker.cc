@@ -2745,7 +2745,7 @@ namespace {
 	const std::string _TASK_GRAPH_NAME = "mediapipe.tasks.vision.face_landmarker.FaceLandmarkerGraph";
 	const int64_t _MICRO_SECONDS_PER_MILLISECOND = 1000;
 
-	[[nodiscard]] absl::StatusOr<std::shared_ptr<FaceLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets) {
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<FaceLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets, bool landmarks_as_mat, category::LabelTableCache* label_tables) {
 		if (output_packets.at(_NORM_LANDMARKS_STREAM_NAME).IsEmpty()) {
 			return std::make_shared<FaceLandmarkerResult>();
 		}
@@ -2754,6 +2754,11 @@ namespace {
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& face_landmarks_proto_list, std::vector<NormalizedLandmarkList>, output_packets.at(_NORM_LANDMARKS_STREAM_NAME));
 		for (const auto& face_landmarks : face_landmarks_proto_list) {
+			if (landmarks_as_mat) {
+				face_landmarker_result->face_landmarks_mat.push_back(landmark::ToMat(face_landmarks));
+				continue;
+			}
+
 			std::vector<std::shared_ptr<landmark::NormalizedLandmark>> face_landmarks_list;
 
 			for (const auto& face_landmark : face_landmarks.landmark()) {
@@ -2766,6 +2771,11 @@ namespace {
 		if (output_packets.count(_BLENDSHAPES_STREAM_NAME)) {
 			MP_PACKET_ASSIGN_OR_RETURN(const auto& face_blendshapes_proto_list, std::vector<ClassificationList>, output_packets.at(_BLENDSHAPES_STREAM_NAME));
 			for (const auto& face_blendshapes_classifications : face_blendshapes_proto_list) {
+				if (label_tables) {
+					face_landmarker_result->face_blendshapes_compact.push_back(label_tables->ToCompact(face_blendshapes_classifications));
+					continue;
+				}
+
 				std::vector<std::shared_ptr<category::Category>> face_blendshapes_categories;
 
 				for (const auto& face_blendshapes : face_blendshapes_classifications.classification()) {
@@ -2830,10 +2840,11 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 	absl::StatusOr<std::shared_ptr<FaceLandmarker>> FaceLandmarker::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<FaceLandmarker*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<FaceLandmarker*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<FaceLandmarker>> FaceLandmarker::create_from_model_path(const std::string& model_path) {
@@ -2842,16 +2853,19 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 	}
 
 	absl::StatusOr<std::shared_ptr<FaceLandmarker>> FaceLandmarker::create_from_options(std::shared_ptr<FaceLandmarkerOptions> options) {
+		auto label_tables = options->output_compact_categories ? std::make_shared<components::containers::category::LabelTableCache>() : nullptr;
 		PacketsCallback packet_callback = nullptr;
 
 		if (options->result_callback) {
-			packet_callback = [options](const PacketMap& output_packets) {
+			// read once, the options may be changed after the task is created
+			const bool landmarks_as_mat = options->output_landmarks_as_mat;
+			packet_callback = [options, label_tables, landmarks_as_mat](const PacketMap& output_packets) {
 				const auto& image_out_packet = output_packets.at(_IMAGE_OUT_STREAM_NAME);
 				if (image_out_packet.IsEmpty()) {
 					return;
 				}
 
-				MP_ASSIGN_OR_THROW(auto face_landmarker_result, _build_landmarker_result(output_packets)); // There is no other choice than throw in a callback to stop the execution
+				MP_ASSIGN_OR_THROW(auto face_landmarker_result, _build_landmarker_result(output_packets, landmarks_as_mat, label_tables.get())); // There is no other choice than throw in a callback to stop the execution
 				MP_PACKET_ASSIGN_OR_THROW(const auto& image, Image, image_out_packet); // There is no other choice than throw in a callback to stop the execution
 				auto timestamp_ms = output_packets.at(_NORM_LANDMARKS_STREAM_NAME).Timestamp().Value() / _MICRO_SECONDS_PER_MILLISECOND;
 
@@ -2882,13 +2896,23 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 
 		MP_ASSIGN_OR_RETURN(task_info.task_options, options->to_pb2());
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		task->_label_tables = label_tables;
+		task->_output_landmarks_as_mat = options->output_landmarks_as_mat;
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> FaceLandmarker::create_from_options_async(std::shared_ptr<FaceLandmarkerOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &FaceLandmarker::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<FaceLandmarkerResult>> FaceLandmarker::detect(
@@ -2898,11 +2922,11 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat, _label_tables.get());
 	}
 
 	absl::StatusOr<std::shared_ptr<FaceLandmarkerResult>> FaceLandmarker::detect_for_video(
@@ -2913,7 +2937,7 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -2921,7 +2945,7 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 			)) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat, _label_tables.get());
 	}
 
 	absl::Status FaceLandmarker::detect_async(
@@ -2932,7 +2956,7 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -102,22 +102,30 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 		CV_WRAP FaceLandmarkerResult(
 			const std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>>& face_landmarks = std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>>(),
 			const std::vector<std::vector<std::shared_ptr<components::containers::category::Category>>>& face_blendshapes = std::vector<std::vector<std::shared_ptr<components::containers::category::Category>>>(),
-			const std::vector<cv::Mat>& facial_transformation_matrixes = std::vector<cv::Mat>()
+			const std::vector<cv::Mat>& facial_transformation_matrixes = std::vector<cv::Mat>(),
+			const std::vector<cv::Mat>& face_landmarks_mat = std::vector<cv::Mat>(),
+			const std::vector<std::shared_ptr<components::containers::category::CompactCategories>>& face_blendshapes_compact = std::vector<std::shared_ptr<components::containers::category::CompactCategories>>()
 		) :
 			face_landmarks(face_landmarks),
 			face_blendshapes(face_blendshapes),
-			facial_transformation_matrixes(facial_transformation_matrixes)
+			facial_transformation_matrixes(facial_transformation_matrixes),
+			face_landmarks_mat(face_landmarks_mat),
+			face_blendshapes_compact(face_blendshapes_compact)
 		{}
 
 		bool operator== (const FaceLandmarkerResult& other) const {
 			return ::mediapipe::lua::__eq__(face_landmarks, other.face_landmarks) &&
 				::mediapipe::lua::__eq__(face_blendshapes, other.face_blendshapes) &&
-				::mediapipe::lua::__eq__(facial_transformation_matrixes, other.facial_transformation_matrixes);
+				::mediapipe::lua::__eq__(facial_transformation_matrixes, other.facial_transformation_matrixes) &&
+				::mediapipe::lua::__eq__(face_landmarks_mat, other.face_landmarks_mat) &&
+				::mediapipe::lua::__eq__(face_blendshapes_compact, other.face_blendshapes_compact);
 		}
 
 		CV_PROP_RW std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>> face_landmarks;
 		CV_PROP_RW std::vector<std::vector<std::shared_ptr<components::containers::category::Category>>> face_blendshapes;
 		CV_PROP_RW std::vector<cv::Mat> facial_transformation_matrixes;
+		CV_PROP_RW std::vector<cv::Mat> face_landmarks_mat;
+		CV_PROP_RW std::vector<std::shared_ptr<components::containers::category::CompactCategories>> face_blendshapes_compact;
 	};
 
 	using FaceLandmarkerResultCallback = std::function<void(const FaceLandmarkerResult&, const Image&, int64_t)>;
@@ -135,7 +143,11 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 			float min_tracking_confidence = 0.5f,
 			bool output_face_blendshapes = false,
 			bool output_facial_transformation_matrixes = false,
-			FaceLandmarkerResultCallback result_callback = nullptr
+			FaceLandmarkerResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			bool output_landmarks_as_mat = false,
+			bool output_compact_categories = false,
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		) :
 			base_options(base_options),
 			running_mode(running_mode),
@@ -145,7 +157,11 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 			min_tracking_confidence(min_tracking_confidence),
 			output_face_blendshapes(output_face_blendshapes),
 			output_facial_transformation_matrixes(output_facial_transformation_matrixes),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			output_landmarks_as_mat(output_landmarks_as_mat),
+			output_compact_categories(output_compact_categories),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::face_landmarker::proto::FaceLandmarkerGraphOptions>> to_pb2() const;
@@ -159,6 +175,13 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 		CV_PROP_RW bool output_face_blendshapes;
 		CV_PROP_RW bool output_facial_transformation_matrixes;
 		CV_PROP_W  FaceLandmarkerResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Landmarks are returned as N x 5 (x, y, z, visibility, presence) float matrices in the *_mat fields instead of objects
+		CV_PROP_RW bool output_landmarks_as_mat;
+		// Blendshapes are returned as a score matrix with a shared label table in face_blendshapes_compact instead of category objects
+		CV_PROP_RW bool output_compact_categories;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W FaceLandmarker : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -168,10 +191,12 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceLandmarker>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceLandmarker>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceLandmarker>> create_from_options(std::shared_ptr<FaceLandmarkerOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<FaceLandmarkerOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<FaceLandmarkerResult>> detect(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_option
@@ -189,5 +214,8 @@ namespace mediapipe::tasks::lua::vision::face_landmarker {
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options
 			= std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
 		);
+	private:
+		std::shared_ptr<components::containers::category::LabelTableCache> _label_tables;
+		bool _output_landmarks_as_mat = false;
 	};
 }
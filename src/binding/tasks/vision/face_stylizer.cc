@@ -41,10 +41,11 @@ namespace mediapipe::tasks::lua::vision::face_stylizer {
 	absl::StatusOr<std::shared_ptr<FaceStylizer>> FaceStylizer::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<FaceStylizer*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<FaceStylizer*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<FaceStylizer>> FaceStylizer::create_from_model_path(const std::string& model_path) {
@@ -67,10 +68,18 @@ namespace mediapipe::tasks::lua::vision::face_stylizer {
 
 		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config());
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
-			VisionTaskRunningMode::IMAGE
-		);
+			VisionTaskRunningMode::IMAGE,
+			nullptr,
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> FaceStylizer::create_from_options_async(std::shared_ptr<FaceStylizerOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &FaceStylizer::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<Image>> FaceStylizer::stylize(
@@ -80,7 +89,7 @@ namespace mediapipe::tasks::lua::vision::face_stylizer {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
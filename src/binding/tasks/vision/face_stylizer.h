@@ -33,10 +33,12 @@ namespace mediapipe::tasks::lua::vision::face_stylizer {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceStylizer>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceStylizer>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<FaceStylizer>> create_from_options(std::shared_ptr<FaceStylizerOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<FaceStylizerOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<Image>> stylize(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options =
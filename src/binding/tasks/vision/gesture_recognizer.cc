@@ -138,10 +138,11 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 	absl::StatusOr<std::shared_ptr<GestureRecognizer>> GestureRecognizer::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<GestureRecognizer*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<GestureRecognizer*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<GestureRecognizer>> GestureRecognizer::create_from_model_path(const std::string& model_path) {
@@ -183,13 +184,21 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 
 		MP_ASSIGN_OR_RETURN(task_info.task_options, options->to_pb2());
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> GestureRecognizer::create_from_options_async(std::shared_ptr<GestureRecognizerOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &GestureRecognizer::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<GestureRecognizerResult>> GestureRecognizer::recognize(
@@ -199,7 +208,7 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
@@ -214,7 +223,7 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -233,7 +242,7 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
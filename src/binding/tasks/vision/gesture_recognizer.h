@@ -58,7 +58,9 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 			float min_tracking_confidence = 0.5f,
 			std::shared_ptr<components::processors::classifier_options::ClassifierOptions> canned_gesture_classifier_options = std::shared_ptr<components::processors::classifier_options::ClassifierOptions>(),
 			std::shared_ptr<components::processors::classifier_options::ClassifierOptions> custom_gesture_classifier_options = std::shared_ptr<components::processors::classifier_options::ClassifierOptions>(),
-			GestureRecognizerResultCallback result_callback = nullptr
+			GestureRecognizerResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		) :
 			base_options(base_options),
 			running_mode(running_mode),
@@ -68,7 +70,9 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 			min_tracking_confidence(min_tracking_confidence),
 			canned_gesture_classifier_options(canned_gesture_classifier_options),
 			custom_gesture_classifier_options(custom_gesture_classifier_options),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::gesture_recognizer::proto::GestureRecognizerGraphOptions>> to_pb2() const;
@@ -82,6 +86,9 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 		CV_PROP_RW std::shared_ptr<components::processors::classifier_options::ClassifierOptions> canned_gesture_classifier_options;
 		CV_PROP_RW std::shared_ptr<components::processors::classifier_options::ClassifierOptions> custom_gesture_classifier_options;
 		CV_PROP_W  GestureRecognizerResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W GestureRecognizer : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -91,10 +98,12 @@ namespace mediapipe::tasks::lua::vision::gesture_recognizer {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<GestureRecognizer>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<GestureRecognizer>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<GestureRecognizer>> create_from_options(std::shared_ptr<GestureRecognizerOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<GestureRecognizerOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<GestureRecognizerResult>> recognize(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
@@ -265,7 +265,7 @@ namespace {
 	const std::string _TASK_GRAPH_NAME = "mediapipe.tasks.vision.hand_landmarker.HandLandmarkerGraph";
 	const int64_t _MICRO_SECONDS_PER_MILLISECOND = 1000;
 
-	[[nodiscard]] absl::StatusOr<std::shared_ptr<HandLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets) {
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<HandLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets, bool landmarks_as_mat) {
 		if (output_packets.at(_HAND_LANDMARKS_STREAM_NAME).IsEmpty()) {
 			return std::make_shared<HandLandmarkerResult>();
 		}
@@ -290,6 +290,11 @@ namespace {
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& hand_landmarks_proto_list, std::vector<NormalizedLandmarkList>, output_packets.at(_HAND_LANDMARKS_STREAM_NAME));
 		for (const auto& hand_landmarks : hand_landmarks_proto_list) {
+			if (landmarks_as_mat) {
+				hand_landmarker_result->hand_landmarks_mat.push_back(landmark::ToMat(hand_landmarks));
+				continue;
+			}
+
 			std::vector<std::shared_ptr<landmark::NormalizedLandmark>> hand_landmarks_list;
 
 			for (const auto& hand_landmark : hand_landmarks.landmark()) {
@@ -301,6 +306,11 @@ namespace {
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& hand_world_landmarks_proto_list, std::vector<LandmarkList>, output_packets.at(_HAND_WORLD_LANDMARKS_STREAM_NAME));
 		for (const auto& hand_world_landmarks : hand_world_landmarks_proto_list) {
+			if (landmarks_as_mat) {
+				hand_landmarker_result->hand_world_landmarks_mat.push_back(landmark::ToMat(hand_world_landmarks));
+				continue;
+			}
+
 			std::vector<std::shared_ptr<landmark::Landmark>> hand_world_landmarks_list;
 
 			for (const auto& hand_world_landmark : hand_world_landmarks.landmark()) {
@@ -339,10 +349,11 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 	absl::StatusOr<std::shared_ptr<HandLandmarker>> HandLandmarker::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<HandLandmarker*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<HandLandmarker*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<HandLandmarker>> HandLandmarker::create_from_model_path(const std::string& model_path) {
@@ -354,13 +365,14 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		PacketsCallback packet_callback = nullptr;
 
 		if (options->result_callback) {
-			packet_callback = [options](const PacketMap& output_packets) {
+			const bool landmarks_as_mat = options->output_landmarks_as_mat;
+			packet_callback = [options, landmarks_as_mat](const PacketMap& output_packets) {
 				const auto& image_out_packet = output_packets.at(_IMAGE_OUT_STREAM_NAME);
 				if (image_out_packet.IsEmpty()) {
 					return;
 				}
 
-				MP_ASSIGN_OR_THROW(auto hand_landmarker_result, _build_landmarker_result(output_packets)); // There is no other choice than throw in a callback to stop the execution
+				MP_ASSIGN_OR_THROW(auto hand_landmarker_result, _build_landmarker_result(output_packets, landmarks_as_mat)); // There is no other choice than throw in a callback to stop the execution
 				MP_PACKET_ASSIGN_OR_THROW(const auto& image, Image, image_out_packet); // There is no other choice than throw in a callback to stop the execution
 				auto timestamp_ms = output_packets.at(_HAND_LANDMARKS_STREAM_NAME).Timestamp().Value() / _MICRO_SECONDS_PER_MILLISECOND;
 
@@ -382,13 +394,22 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		};
 		MP_ASSIGN_OR_RETURN(task_info.task_options, options->to_pb2());
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		task->_output_landmarks_as_mat = options->output_landmarks_as_mat;
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> HandLandmarker::create_from_options_async(std::shared_ptr<HandLandmarkerOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &HandLandmarker::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<HandLandmarkerResult>> HandLandmarker::detect(
@@ -398,11 +419,11 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat);
 	}
 
 	absl::StatusOr<std::shared_ptr<HandLandmarkerResult>> HandLandmarker::detect_for_video(
@@ -413,7 +434,7 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -421,7 +442,7 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 			)) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat);
 	}
 
 	absl::Status HandLandmarker::detect_async(
@@ -432,7 +453,7 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -65,22 +65,30 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		CV_WRAP HandLandmarkerResult(
 			const std::vector<std::vector<std::shared_ptr<components::containers::category::Category>>>& handedness = std::vector<std::vector<std::shared_ptr<components::containers::category::Category>>>(),
 			const std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>>& hand_landmarks = std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>>(),
-			const std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>>& hand_world_landmarks = std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>>()
+			const std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>>& hand_world_landmarks = std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>>(),
+			const std::vector<cv::Mat>& hand_landmarks_mat = std::vector<cv::Mat>(),
+			const std::vector<cv::Mat>& hand_world_landmarks_mat = std::vector<cv::Mat>()
 		) :
 			handedness(handedness),
 			hand_landmarks(hand_landmarks),
-			hand_world_landmarks(hand_world_landmarks)
+			hand_world_landmarks(hand_world_landmarks),
+			hand_landmarks_mat(hand_landmarks_mat),
+			hand_world_landmarks_mat(hand_world_landmarks_mat)
 		{}
 
 		bool operator== (const HandLandmarkerResult& other) const {
 			return ::mediapipe::lua::__eq__(handedness, other.handedness) &&
 				::mediapipe::lua::__eq__(hand_landmarks, other.hand_landmarks) &&
-				::mediapipe::lua::__eq__(hand_world_landmarks, other.hand_world_landmarks);
+				::mediapipe::lua::__eq__(hand_world_landmarks, other.hand_world_landmarks) &&
+				::mediapipe::lua::__eq__(hand_landmarks_mat, other.hand_landmarks_mat) &&
+				::mediapipe::lua::__eq__(hand_world_landmarks_mat, other.hand_world_landmarks_mat);
 		}
 
 		CV_PROP_RW std::vector<std::vector<std::shared_ptr<components::containers::category::Category>>> handedness;
 		CV_PROP_RW std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>> hand_landmarks;
 		CV_PROP_RW std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>> hand_world_landmarks;
+		CV_PROP_RW std::vector<cv::Mat> hand_landmarks_mat;
+		CV_PROP_RW std::vector<cv::Mat> hand_world_landmarks_mat;
 	};
 
 	using HandLandmarkerResultCallback = std::function<void(const HandLandmarkerResult&, const Image&, int64_t)>;
@@ -96,7 +104,10 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 			float min_hand_detection_confidence = 0.5f,
 			float min_hand_presence_confidence = 0.5f,
 			float min_tracking_confidence = 0.5f,
-			HandLandmarkerResultCallback result_callback = nullptr
+			HandLandmarkerResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			bool output_landmarks_as_mat = false,
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		) :
 			base_options(base_options),
 			running_mode(running_mode),
@@ -104,7 +115,10 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 			min_hand_detection_confidence(min_hand_detection_confidence),
 			min_hand_presence_confidence(min_hand_presence_confidence),
 			min_tracking_confidence(min_tracking_confidence),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			output_landmarks_as_mat(output_landmarks_as_mat),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::hand_landmarker::proto::HandLandmarkerGraphOptions>> to_pb2() const;
@@ -116,6 +130,11 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		CV_PROP_RW float min_hand_presence_confidence;
 		CV_PROP_RW float min_tracking_confidence;
 		CV_PROP_W  HandLandmarkerResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Landmarks are returned as N x 5 (x, y, z, visibility, presence) float matrices in the *_mat fields instead of objects
+		CV_PROP_RW bool output_landmarks_as_mat;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W HandLandmarker : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -125,10 +144,12 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<HandLandmarker>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<HandLandmarker>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<HandLandmarker>> create_from_options(std::shared_ptr<HandLandmarkerOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<HandLandmarkerOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<HandLandmarkerResult>> detect(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
@@ -143,5 +164,7 @@ namespace mediapipe::tasks::lua::vision::hand_landmarker {
 			int64_t timestamp_ms,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
 		);
+	private:
+		bool _output_landmarks_as_mat = false;
 	};
 }
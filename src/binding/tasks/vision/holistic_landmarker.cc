@@ -47,7 +47,7 @@ namespace {
 	const std::string _TASK_GRAPH_NAME = "mediapipe.tasks.vision.holistic_landmarker.HolisticLandmarkerGraph";
 	const int64_t _MICRO_SECONDS_PER_MILLISECOND = 1000;
 
-	[[nodiscard]] absl::StatusOr<std::shared_ptr<HolisticLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets) {
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<HolisticLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets, bool landmarks_as_mat, category::LabelTableCache* label_tables) {
 		if (output_packets.at(_FACE_LANDMARKS_STREAM_NAME).IsEmpty()) {
 			return std::make_shared<HolisticLandmarkerResult>();
 		}
@@ -68,44 +68,60 @@ namespace {
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& right_hand_world_landmarks_proto_list, LandmarkList, output_packets.at(_RIGHT_HAND_WORLD_LANDMARKS_STREAM_NAME));
 
-		for (const auto& face_landmark : face_landmarks_proto_list.landmark()) {
-			holistic_landmarker_result->face_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(face_landmark)));
+		if (landmarks_as_mat) {
+			holistic_landmarker_result->face_landmarks_mat = landmark::ToMat(face_landmarks_proto_list);
+			holistic_landmarker_result->pose_landmarks_mat = landmark::ToMat(pose_landmarks_proto_list);
+			holistic_landmarker_result->pose_world_landmarks_mat = landmark::ToMat(pose_world_landmarks_proto_list);
+			holistic_landmarker_result->left_hand_landmarks_mat = landmark::ToMat(left_hand_landmarks_proto_list);
+			holistic_landmarker_result->left_hand_world_landmarks_mat = landmark::ToMat(left_hand_world_landmarks_proto_list);
+			holistic_landmarker_result->right_hand_landmarks_mat = landmark::ToMat(right_hand_landmarks_proto_list);
+			holistic_landmarker_result->right_hand_world_landmarks_mat = landmark::ToMat(right_hand_world_landmarks_proto_list);
 		}
+		else {
+			for (const auto& face_landmark : face_landmarks_proto_list.landmark()) {
+				holistic_landmarker_result->face_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(face_landmark)));
+			}
 
-		for (const auto& pose_landmark : pose_landmarks_proto_list.landmark()) {
-			holistic_landmarker_result->pose_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(pose_landmark)));
-		}
+			for (const auto& pose_landmark : pose_landmarks_proto_list.landmark()) {
+				holistic_landmarker_result->pose_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(pose_landmark)));
+			}
 
-		for (const auto& pose_world_landmark : pose_world_landmarks_proto_list.landmark()) {
-			holistic_landmarker_result->pose_world_landmarks.push_back(std::move(landmark::Landmark::create_from_pb2(pose_world_landmark)));
-		}
+			for (const auto& pose_world_landmark : pose_world_landmarks_proto_list.landmark()) {
+				holistic_landmarker_result->pose_world_landmarks.push_back(std::move(landmark::Landmark::create_from_pb2(pose_world_landmark)));
+			}
 
-		for (const auto& left_hand_landmark : left_hand_landmarks_proto_list.landmark()) {
-			holistic_landmarker_result->left_hand_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(left_hand_landmark)));
-		}
+			for (const auto& left_hand_landmark : left_hand_landmarks_proto_list.landmark()) {
+				holistic_landmarker_result->left_hand_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(left_hand_landmark)));
+			}
 
-		for (const auto& left_hand_world_landmark : left_hand_world_landmarks_proto_list.landmark()) {
-			holistic_landmarker_result->left_hand_world_landmarks.push_back(std::move(landmark::Landmark::create_from_pb2(left_hand_world_landmark)));
-		}
+			for (const auto& left_hand_world_landmark : left_hand_world_landmarks_proto_list.landmark()) {
+				holistic_landmarker_result->left_hand_world_landmarks.push_back(std::move(landmark::Landmark::create_from_pb2(left_hand_world_landmark)));
+			}
 
-		for (const auto& right_hand_landmark : right_hand_landmarks_proto_list.landmark()) {
-			holistic_landmarker_result->right_hand_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(right_hand_landmark)));
-		}
+			for (const auto& right_hand_landmark : right_hand_landmarks_proto_list.landmark()) {
+				holistic_landmarker_result->right_hand_landmarks.push_back(std::move(landmark::NormalizedLandmark::create_from_pb2(right_hand_landmark)));
+			}
 
-		for (const auto& right_hand_world_landmark : right_hand_world_landmarks_proto_list.landmark()) {
-			holistic_landmarker_result->right_hand_world_landmarks.push_back(std::move(landmark::Landmark::create_from_pb2(right_hand_world_landmark)));
+			for (const auto& right_hand_world_landmark : right_hand_world_landmarks_proto_list.landmark()) {
+				holistic_landmarker_result->right_hand_world_landmarks.push_back(std::move(landmark::Landmark::create_from_pb2(right_hand_world_landmark)));
+			}
 		}
 
 		if (output_packets.count(_FACE_BLENDSHAPES_STREAM_NAME)) {
 			MP_PACKET_ASSIGN_OR_RETURN(const auto& face_blendshapes_proto_list, ClassificationList, output_packets.at(_FACE_BLENDSHAPES_STREAM_NAME));
 
-			for (const auto& face_blendshapes : face_blendshapes_proto_list.classification()) {
-				holistic_landmarker_result->face_blendshapes.push_back(std::move(std::make_shared<category::Category>(
-					face_blendshapes.index(),
-					face_blendshapes.score(),
-					face_blendshapes.display_name(),
-					face_blendshapes.label()
-				)));
+			if (label_tables) {
+				holistic_landmarker_result->face_blendshapes_compact = label_tables->ToCompact(face_blendshapes_proto_list);
+			}
+			else {
+				for (const auto& face_blendshapes : face_blendshapes_proto_list.classification()) {
+					holistic_landmarker_result->face_blendshapes.push_back(std::move(std::make_shared<category::Category>(
+						face_blendshapes.index(),
+						face_blendshapes.score(),
+						face_blendshapes.display_name(),
+						face_blendshapes.label()
+					)));
+				}
 			}
 		}
 
@@ -185,10 +201,11 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 	absl::StatusOr<std::shared_ptr<HolisticLandmarker>> HolisticLandmarker::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<HolisticLandmarker*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<HolisticLandmarker*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<HolisticLandmarker>> HolisticLandmarker::create_from_model_path(const std::string& model_path) {
@@ -197,16 +214,18 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 	}
 
 	absl::StatusOr<std::shared_ptr<HolisticLandmarker>> HolisticLandmarker::create_from_options(std::shared_ptr<HolisticLandmarkerOptions> options) {
+		auto label_tables = options->output_compact_categories ? std::make_shared<components::containers::category::LabelTableCache>() : nullptr;
 		PacketsCallback packet_callback = nullptr;
 
 		if (options->result_callback) {
-			packet_callback = [options](const PacketMap& output_packets) {
+			const bool landmarks_as_mat = options->output_landmarks_as_mat;
+			packet_callback = [options, label_tables, landmarks_as_mat](const PacketMap& output_packets) {
 				const auto& image_out_packet = output_packets.at(_IMAGE_OUT_STREAM_NAME);
 				if (image_out_packet.IsEmpty()) {
 					return;
 				}
 
-				MP_ASSIGN_OR_THROW(auto holistic_landmarks_detection_result, _build_landmarker_result(output_packets)); // There is no other choice than throw in a callback to stop the execution
+				MP_ASSIGN_OR_THROW(auto holistic_landmarks_detection_result, _build_landmarker_result(output_packets, landmarks_as_mat, label_tables.get())); // There is no other choice than throw in a callback to stop the execution
 				MP_PACKET_ASSIGN_OR_THROW(const auto& image, Image, image_out_packet); // There is no other choice than throw in a callback to stop the execution
 				auto timestamp_ms = output_packets.at(_FACE_LANDMARKS_STREAM_NAME).Timestamp().Value() / _MICRO_SECONDS_PER_MILLISECOND;
 
@@ -239,13 +258,23 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 			task_info.output_streams.push_back(_FACE_BLENDSHAPES_TAG + ":" + _FACE_BLENDSHAPES_STREAM_NAME);
 		}
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		task->_label_tables = label_tables;
+		task->_output_landmarks_as_mat = options->output_landmarks_as_mat;
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> HolisticLandmarker::create_from_options_async(std::shared_ptr<HolisticLandmarkerOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &HolisticLandmarker::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<HolisticLandmarkerResult>> HolisticLandmarker::detect(
@@ -253,10 +282,10 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 		std::shared_ptr<ImageProcessingOptions> image_processing_options
 	) {
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat, _label_tables.get());
 	}
 
 	absl::StatusOr<std::shared_ptr<HolisticLandmarkerResult>> HolisticLandmarker::detect_for_video(
@@ -265,12 +294,12 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 		std::shared_ptr<ImageProcessingOptions> image_processing_options
 	) {
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat, _label_tables.get());
 	}
 
 	absl::Status HolisticLandmarker::detect_async(
@@ -279,7 +308,7 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 		std::shared_ptr<ImageProcessingOptions> image_processing_options
 	) {
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			});
@@ -27,7 +27,15 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 			const std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>& right_hand_landmarks = std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>(),
 			const std::vector<std::shared_ptr<components::containers::landmark::Landmark>>& right_hand_world_landmarks = std::vector<std::shared_ptr<components::containers::landmark::Landmark>>(),
 			const std::vector<std::shared_ptr<components::containers::category::Category>>& face_blendshapes = std::vector<std::shared_ptr<components::containers::category::Category>>(),
-			const std::shared_ptr<Image>& segmentation_mask = std::shared_ptr<Image>()
+			const std::shared_ptr<Image>& segmentation_mask = std::shared_ptr<Image>(),
+			const cv::Mat& face_landmarks_mat = cv::Mat(),
+			const cv::Mat& pose_landmarks_mat = cv::Mat(),
+			const cv::Mat& pose_world_landmarks_mat = cv::Mat(),
+			const cv::Mat& left_hand_landmarks_mat = cv::Mat(),
+			const cv::Mat& left_hand_world_landmarks_mat = cv::Mat(),
+			const cv::Mat& right_hand_landmarks_mat = cv::Mat(),
+			const cv::Mat& right_hand_world_landmarks_mat = cv::Mat(),
+			const std::shared_ptr<components::containers::category::CompactCategories>& face_blendshapes_compact = std::shared_ptr<components::containers::category::CompactCategories>()
 		) :
 			face_landmarks(face_landmarks),
 			pose_landmarks(pose_landmarks),
@@ -37,7 +45,15 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 			right_hand_landmarks(right_hand_landmarks),
 			right_hand_world_landmarks(right_hand_world_landmarks),
 			face_blendshapes(face_blendshapes),
-			segmentation_mask(segmentation_mask)
+			segmentation_mask(segmentation_mask),
+			face_landmarks_mat(face_landmarks_mat),
+			pose_landmarks_mat(pose_landmarks_mat),
+			pose_world_landmarks_mat(pose_world_landmarks_mat),
+			left_hand_landmarks_mat(left_hand_landmarks_mat),
+			left_hand_world_landmarks_mat(left_hand_world_landmarks_mat),
+			right_hand_landmarks_mat(right_hand_landmarks_mat),
+			right_hand_world_landmarks_mat(right_hand_world_landmarks_mat),
+			face_blendshapes_compact(face_blendshapes_compact)
 		{}
 
 		CV_WRAP static std::shared_ptr<HolisticLandmarkerResult> create_from_pb2(const mediapipe::tasks::vision::holistic_landmarker::proto::HolisticResult& pb2_obj);
@@ -51,7 +67,15 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 				::mediapipe::lua::__eq__(right_hand_landmarks, other.right_hand_landmarks) &&
 				::mediapipe::lua::__eq__(right_hand_world_landmarks, other.right_hand_world_landmarks) &&
 				::mediapipe::lua::__eq__(face_blendshapes, other.face_blendshapes) &&
-				::mediapipe::lua::__eq__(segmentation_mask, other.segmentation_mask);
+				::mediapipe::lua::__eq__(segmentation_mask, other.segmentation_mask) &&
+				::mediapipe::lua::__eq__(face_landmarks_mat, other.face_landmarks_mat) &&
+				::mediapipe::lua::__eq__(pose_landmarks_mat, other.pose_landmarks_mat) &&
+				::mediapipe::lua::__eq__(pose_world_landmarks_mat, other.pose_world_landmarks_mat) &&
+				::mediapipe::lua::__eq__(left_hand_landmarks_mat, other.left_hand_landmarks_mat) &&
+				::mediapipe::lua::__eq__(left_hand_world_landmarks_mat, other.left_hand_world_landmarks_mat) &&
+				::mediapipe::lua::__eq__(right_hand_landmarks_mat, other.right_hand_landmarks_mat) &&
+				::mediapipe::lua::__eq__(right_hand_world_landmarks_mat, other.right_hand_world_landmarks_mat) &&
+				::mediapipe::lua::__eq__(face_blendshapes_compact, other.face_blendshapes_compact);
 		}
 
 		CV_PROP_RW std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>> face_landmarks;
@@ -63,6 +87,14 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 		CV_PROP_RW std::vector<std::shared_ptr<components::containers::landmark::Landmark>> right_hand_world_landmarks;
 		CV_PROP_RW std::vector<std::shared_ptr<components::containers::category::Category>> face_blendshapes;
 		CV_PROP_RW std::shared_ptr<Image> segmentation_mask;
+		CV_PROP_RW cv::Mat face_landmarks_mat;
+		CV_PROP_RW cv::Mat pose_landmarks_mat;
+		CV_PROP_RW cv::Mat pose_world_landmarks_mat;
+		CV_PROP_RW cv::Mat left_hand_landmarks_mat;
+		CV_PROP_RW cv::Mat left_hand_world_landmarks_mat;
+		CV_PROP_RW cv::Mat right_hand_landmarks_mat;
+		CV_PROP_RW cv::Mat right_hand_world_landmarks_mat;
+		CV_PROP_RW std::shared_ptr<components::containers::category::CompactCategories> face_blendshapes_compact;
 	};
 
 	using HolisticLandmarkerResultCallback = std::function<void(const HolisticLandmarkerResult&, const Image&, int64_t)>;
@@ -83,7 +115,11 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 			float min_hand_landmarks_confidence = 0.5f,
 			bool output_face_blendshapes = false,
 			bool output_segmentation_mask = false,
-			HolisticLandmarkerResultCallback result_callback = nullptr
+			HolisticLandmarkerResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			bool output_landmarks_as_mat = false,
+			bool output_compact_categories = false,
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		) :
 			base_options(base_options),
 			running_mode(running_mode),
@@ -96,7 +132,11 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 			min_hand_landmarks_confidence(min_hand_landmarks_confidence),
 			output_face_blendshapes(output_face_blendshapes),
 			output_segmentation_mask(output_segmentation_mask),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			output_landmarks_as_mat(output_landmarks_as_mat),
+			output_compact_categories(output_compact_categories),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::holistic_landmarker::proto::HolisticLandmarkerGraphOptions>> to_pb2() const;
@@ -113,6 +153,13 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 		CV_PROP_RW bool output_face_blendshapes;
 		CV_PROP_RW bool output_segmentation_mask;
 		CV_PROP_W  HolisticLandmarkerResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Landmarks are returned as N x 5 (x, y, z, visibility, presence) float matrices in the *_mat fields instead of objects
+		CV_PROP_RW bool output_landmarks_as_mat;
+		// Blendshapes are returned as a score matrix with a shared label table in face_blendshapes_compact instead of category objects
+		CV_PROP_RW bool output_compact_categories;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W HolisticLandmarker : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -122,10 +169,12 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<HolisticLandmarker>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<HolisticLandmarker>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<HolisticLandmarker>> create_from_options(std::shared_ptr<HolisticLandmarkerOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<HolisticLandmarkerOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<HolisticLandmarkerResult>> detect(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
@@ -140,5 +189,8 @@ namespace mediapipe::tasks::lua::vision::holistic_landmarker {
 			int64_t timestamp_ms,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
 		);
+	private:
+		std::shared_ptr<components::containers::category::LabelTableCache> _label_tables;
+		bool _output_landmarks_as_mat = false;
 	};
 }
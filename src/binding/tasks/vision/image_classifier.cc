@@ -12,6 +12,7 @@ namespace {
 	using namespace mediapipe::tasks::vision::image_classifier::proto;
 
 	using mediapipe::lua::PacketsCallback;
+	using mediapipe::tasks::lua::components::containers::category::LabelTableCache;
 	using mediapipe::tasks::core::PacketMap;
 
 	const std::string _CLASSIFICATIONS_STREAM_NAME = "classifications_out";
@@ -24,13 +25,16 @@ namespace {
 	const std::string _TASK_GRAPH_NAME = "mediapipe.tasks.vision.image_classifier.ImageClassifierGraph";
 	const int64_t _MICRO_SECONDS_PER_MILLISECOND = 1000;
 
-	[[nodiscard]] absl::StatusOr<std::shared_ptr<ImageClassifierResult>> _build_classification_result(const PacketMap& output_packets) {
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<ImageClassifierResult>> _build_classification_result(const PacketMap& output_packets, LabelTableCache* label_tables) {
 		const auto& detector_out_packet = output_packets.at(_CLASSIFICATIONS_STREAM_NAME);
 		if (detector_out_packet.IsEmpty()) {
 			return std::make_shared<ImageClassifierResult>();
 		}
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& classification_result_proto, mediapipe::tasks::components::containers::proto::ClassificationResult, output_packets.at(_CLASSIFICATIONS_STREAM_NAME));
+		if (label_tables) {
+			return ImageClassifierResult::create_from_pb2(classification_result_proto, *label_tables);
+		}
 		return ImageClassifierResult::create_from_pb2(classification_result_proto);
 	}
 }
@@ -58,10 +62,11 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 	absl::StatusOr<std::shared_ptr<ImageClassifier>> ImageClassifier::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<ImageClassifier*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<ImageClassifier*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<ImageClassifier>> ImageClassifier::create_from_model_path(const std::string& model_path) {
@@ -70,16 +75,25 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 	}
 
 	absl::StatusOr<std::shared_ptr<ImageClassifier>> ImageClassifier::create_from_options(std::shared_ptr<ImageClassifierOptions> options) {
+		std::shared_ptr<components::containers::category::LabelTableCache> label_tables;
+		if (options->output_compact_categories) {
+			MP_ASSERT_RETURN_IF_ERROR(options->base_options, "base_options must be set to output compact categories");
+			MP_ASSIGN_OR_RETURN(label_tables, components::containers::category::LabelTableCache::CreateFromModel(
+				options->base_options->model_asset_path,
+				options->base_options->model_asset_buffer,
+				options->display_names_locale.value_or("en")
+			));
+		}
 		PacketsCallback packet_callback = nullptr;
 
 		if (options->result_callback) {
-			packet_callback = [options](const PacketMap& output_packets) {
+			packet_callback = [options, label_tables](const PacketMap& output_packets) {
 				const auto& image_out_packet = output_packets.at(_IMAGE_OUT_STREAM_NAME);
 				if (image_out_packet.IsEmpty()) {
 					return;
 				}
 
-				MP_ASSIGN_OR_THROW(auto classification_result, _build_classification_result(output_packets)); // There is no other choice than throw in a callback to stop the execution
+				MP_ASSIGN_OR_THROW(auto classification_result, _build_classification_result(output_packets, label_tables.get())); // There is no other choice than throw in a callback to stop the execution
 				MP_PACKET_ASSIGN_OR_THROW(const auto& image, Image, image_out_packet); // There is no other choice than throw in a callback to stop the execution
 				auto timestamp_ms = output_packets.at(_CLASSIFICATIONS_STREAM_NAME).Timestamp().Value() / _MICRO_SECONDS_PER_MILLISECOND;
 
@@ -99,13 +113,22 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 		};
 		MP_ASSIGN_OR_RETURN(task_info.task_options, options->to_pb2());
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		task->_label_tables = label_tables;
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> ImageClassifier::create_from_options_async(std::shared_ptr<ImageClassifierOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &ImageClassifier::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<ImageClassifierResult>> ImageClassifier::classify(
@@ -115,11 +138,11 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
-		return _build_classification_result(output_packets);
+		return _build_classification_result(output_packets, _label_tables.get());
 	}
 
 	absl::StatusOr<std::shared_ptr<ImageClassifierResult>> ImageClassifier::classify_for_video(
@@ -130,7 +153,7 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -138,7 +161,7 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 			)) },
 			}));
 
-		return _build_classification_result(output_packets);
+		return _build_classification_result(output_packets, _label_tables.get());
 	}
 
 	absl::Status ImageClassifier::classify_async(
@@ -149,7 +172,7 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image));
 
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -31,7 +31,10 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 			const std::optional<float>& score_threshold = std::nullopt,
 			const std::vector<std::string>& category_allowlist = std::vector<std::string>(),
 			const std::vector<std::string>& category_denylist = std::vector<std::string>(),
-			ImageClassifierResultCallback result_callback = nullptr
+			ImageClassifierResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			bool output_compact_categories = false,
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		)
 			:
 			base_options(base_options),
@@ -41,7 +44,10 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 			score_threshold(score_threshold),
 			category_allowlist(category_allowlist),
 			category_denylist(category_denylist),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			output_compact_categories(output_compact_categories),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::image_classifier::proto::ImageClassifierGraphOptions>> to_pb2() const;
@@ -54,6 +60,11 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 		CV_PROP_RW std::vector<std::string> category_allowlist;
 		CV_PROP_RW std::vector<std::string> category_denylist;
 		CV_PROP_W  ImageClassifierResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Each head returns its scores as a matrix with a shared label table in compact instead of category objects
+		CV_PROP_RW bool output_compact_categories;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W ImageClassifier : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -63,10 +74,12 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageClassifier>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageClassifier>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageClassifier>> create_from_options(std::shared_ptr<ImageClassifierOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<ImageClassifierOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<ImageClassifierResult>> classify(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
@@ -81,5 +94,7 @@ namespace mediapipe::tasks::lua::vision::image_classifier {
 			int64_t timestamp_ms,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
 		);
+	private:
+		std::shared_ptr<components::containers::category::LabelTableCache> _label_tables;
 	};
 }
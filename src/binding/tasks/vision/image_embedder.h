@@ -27,14 +27,18 @@ namespace mediapipe::tasks::lua::vision::image_embedder {
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode = tasks::lua::vision::core::vision_task_running_mode::VisionTaskRunningMode::IMAGE,
 			const std::optional<bool>& l2_normalize = std::nullopt,
 			const std::optional<bool>& quantize = std::nullopt,
-			ImageEmbedderResultCallback result_callback = nullptr
+			ImageEmbedderResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		)
 			:
 			base_options(base_options),
 			running_mode(running_mode),
 			l2_normalize(l2_normalize),
 			quantize(quantize),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::image_embedder::proto::ImageEmbedderGraphOptions>> to_pb2() const;
@@ -44,6 +48,9 @@ namespace mediapipe::tasks::lua::vision::image_embedder {
 		CV_PROP_RW std::optional<bool> l2_normalize;
 		CV_PROP_RW std::optional<bool> quantize;
 		CV_PROP_W  ImageEmbedderResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W ImageEmbedder : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -53,10 +60,12 @@ namespace mediapipe::tasks::lua::vision::image_embedder {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageEmbedder>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageEmbedder>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageEmbedder>> create_from_options(std::shared_ptr<ImageEmbedderOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<ImageEmbedderOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<ImageEmbedderResult>> embed(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
@@ -66,10 +66,11 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 	absl::StatusOr<std::shared_ptr<ImageSegmenter>> ImageSegmenter::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		MP_ASSIGN_OR_RETURN(auto vision_task_api, BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<ImageSegmenter*>(nullptr)));
+		MP_ASSIGN_OR_RETURN(auto vision_task_api, BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<ImageSegmenter*>(nullptr), executor));
 		MP_RETURN_IF_ERROR(vision_task_api->labels_status);
 		return vision_task_api;
 	}
@@ -147,13 +148,21 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 			task_info.output_streams.push_back(_CATEGORY_MASK_TAG + ":" + _CATEGORY_MASK_STREAM_NAME);
 		}
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> ImageSegmenter::create_from_options_async(std::shared_ptr<ImageSegmenterOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &ImageSegmenter::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<ImageSegmenterResult>> ImageSegmenter::segment(
@@ -163,7 +172,7 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
@@ -178,7 +187,7 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -197,7 +206,7 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
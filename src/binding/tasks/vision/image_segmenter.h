@@ -45,14 +45,18 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode = tasks::lua::vision::core::vision_task_running_mode::VisionTaskRunningMode::IMAGE,
 			bool output_confidence_masks = true,
 			bool output_category_mask = false,
-			ImageSegmenterResultCallback result_callback = nullptr
+			ImageSegmenterResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		)
 			:
 			base_options(base_options),
 			running_mode(running_mode),
 			output_confidence_masks(output_confidence_masks),
 			output_category_mask(output_category_mask),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::image_segmenter::proto::ImageSegmenterGraphOptions>> to_pb2() const;
@@ -62,6 +66,9 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 		CV_PROP_RW bool output_confidence_masks;
 		CV_PROP_RW bool output_category_mask;
 		CV_PROP_W  ImageSegmenterResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W ImageSegmenter : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -73,10 +80,12 @@ namespace mediapipe::tasks::lua::vision::image_segmenter {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageSegmenter>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageSegmenter>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ImageSegmenter>> create_from_options(std::shared_ptr<ImageSegmenterOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<ImageSegmenterOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<ImageSegmenterResult>> segment(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options =
@@ -65,10 +65,11 @@ namespace mediapipe::tasks::lua::vision::interactive_segmenter {
 	absl::StatusOr<std::shared_ptr<InteractiveSegmenter>> InteractiveSegmenter::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<InteractiveSegmenter*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<InteractiveSegmenter*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<InteractiveSegmenter>> InteractiveSegmenter::create_from_model_path(const std::string& model_path) {
@@ -99,10 +100,18 @@ namespace mediapipe::tasks::lua::vision::interactive_segmenter {
 
 		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(false));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
-			VisionTaskRunningMode::IMAGE
-		);
+			VisionTaskRunningMode::IMAGE,
+			nullptr,
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> InteractiveSegmenter::create_from_options_async(std::shared_ptr<InteractiveSegmenterOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &InteractiveSegmenter::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<InteractiveSegmenterResult>> InteractiveSegmenter::segment(
@@ -115,7 +124,7 @@ namespace mediapipe::tasks::lua::vision::interactive_segmenter {
 		MP_ASSIGN_OR_RETURN(auto render_data_proto, _convert_roi_to_render_data(roi));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _ROI_STREAM_NAME, std::move(*std::move(create_proto(*render_data_proto))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
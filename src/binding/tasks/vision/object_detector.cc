@@ -16,6 +16,7 @@ namespace {
 	using mediapipe::tasks::core::PacketMap;
 
 	using Detection = mediapipe::tasks::lua::components::containers::detections::Detection;
+	using DenseDetections = mediapipe::tasks::lua::components::containers::detections::DenseDetections;
 
 	const std::string _DETECTIONS_OUT_STREAM_NAME = "detections_out";
 	const std::string _DETECTIONS_TAG = "DETECTIONS";
@@ -27,7 +28,7 @@ namespace {
 	const std::string _TASK_GRAPH_NAME = "mediapipe.tasks.vision.ObjectDetectorGraph";
 	const int64_t _MICRO_SECONDS_PER_MILLISECOND = 1000;
 
-	[[nodiscard]] absl::StatusOr<std::shared_ptr<ObjectDetectorResult>> _build_detection_result(const PacketMap& output_packets) {
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<ObjectDetectorResult>> _build_detection_result(const PacketMap& output_packets, bool dense) {
 		const auto& detector_out_packet = output_packets.at(_DETECTIONS_OUT_STREAM_NAME);
 		if (detector_out_packet.IsEmpty()) {
 			return std::make_shared<ObjectDetectorResult>();
@@ -36,6 +37,11 @@ namespace {
 		auto detection_result = std::make_shared<ObjectDetectorResult>();
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& detection_proto_list, std::vector<mediapipe::Detection>, detector_out_packet);
+		if (dense) {
+			detection_result->dense = DenseDetections::create_from_pb2(detection_proto_list);
+			return detection_result;
+		}
+
 		for (const auto& detection : detection_proto_list) {
 			detection_result->detections.push_back(std::move(Detection::create_from_pb2(detection)));
 		}
@@ -66,10 +72,11 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 	absl::StatusOr<std::shared_ptr<ObjectDetector>> ObjectDetector::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<ObjectDetector*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<ObjectDetector*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<ObjectDetector>> ObjectDetector::create_from_model_path(const std::string& model_path) {
@@ -87,7 +94,7 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 					return;
 				}
 
-				MP_ASSIGN_OR_THROW(auto detection_result, _build_detection_result(output_packets)); // There is no other choice than throw in a callback to stop the execution
+				MP_ASSIGN_OR_THROW(auto detection_result, _build_detection_result(output_packets, options->output_dense_detections)); // There is no other choice than throw in a callback to stop the execution
 				MP_PACKET_ASSIGN_OR_THROW(const auto& image, Image, image_out_packet); // There is no other choice than throw in a callback to stop the execution
 				auto timestamp_ms = output_packets.at(_DETECTIONS_OUT_STREAM_NAME).Timestamp().Value() / _MICRO_SECONDS_PER_MILLISECOND;
 
@@ -107,27 +114,59 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 		};
 		MP_ASSIGN_OR_RETURN(task_info.task_options, options->to_pb2());
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		task->_output_dense_detections = options->output_dense_detections;
+
+		if (options->tiling_options) {
+			MP_ASSERT_RETURN_IF_ERROR(options->running_mode != VisionTaskRunningMode::LIVE_STREAM, "Tiling is not supported in live stream mode.");
+			MP_ASSIGN_OR_RETURN(task->_tiled_detector, core::tiled_detector::TiledDetector::Create(
+				*config,
+				*options->tiling_options,
+				options->base_options ? options->base_options->executor : nullptr,
+				options->base_options ? options->base_options->warmup_frames : 0,
+				options->max_results.value_or(-1),
+				_IMAGE_IN_STREAM_NAME,
+				_NORM_RECT_STREAM_NAME,
+				_DETECTIONS_OUT_STREAM_NAME
+			));
+		}
+
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> ObjectDetector::create_from_options_async(std::shared_ptr<ObjectDetectorOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &ObjectDetector::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<ObjectDetectorResult>> ObjectDetector::detect(
 		const Image& image,
 		std::shared_ptr<ImageProcessingOptions> image_processing_options
 	) {
+		// other running modes report their error from the untiled path
+		if (_tiled_detector && _running_mode == VisionTaskRunningMode::IMAGE) {
+			MP_ASSIGN_OR_RETURN(auto detections, _tiled_detector->Detect(image, image_processing_options));
+			return _build_detection_result({
+				{ _DETECTIONS_OUT_STREAM_NAME, mediapipe::MakePacket<std::vector<mediapipe::Detection>>(std::move(detections)) },
+				}, _output_dense_detections);
+		}
+
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
-		return _build_detection_result(output_packets);
+		return _build_detection_result(output_packets, _output_dense_detections);
 	}
 
 	absl::StatusOr<std::shared_ptr<ObjectDetectorResult>> ObjectDetector::detect_for_video(
@@ -135,10 +174,17 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 		int64_t timestamp_ms,
 		std::shared_ptr<ImageProcessingOptions> image_processing_options
 	) {
+		if (_tiled_detector && _running_mode == VisionTaskRunningMode::VIDEO) {
+			MP_ASSIGN_OR_RETURN(auto detections, _tiled_detector->DetectForVideo(image, timestamp_ms, image_processing_options));
+			return _build_detection_result({
+				{ _DETECTIONS_OUT_STREAM_NAME, mediapipe::MakePacket<std::vector<mediapipe::Detection>>(std::move(detections)) },
+				}, _output_dense_detections);
+		}
+
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -146,7 +192,7 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 			)) },
 			}));
 
-		return _build_detection_result(output_packets);
+		return _build_detection_result(output_packets, _output_dense_detections);
 	}
 
 	absl::Status ObjectDetector::detect_async(
@@ -157,7 +203,7 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -7,6 +7,7 @@
 #include "binding/tasks/core/task_info.h"
 #include "binding/tasks/vision/core/base_vision_task_api.h"
 #include "binding/tasks/vision/core/image_processing_options.h"
+#include "binding/tasks/vision/core/tiled_detector.h"
 #include "binding/tasks/vision/core/vision_task_running_mode.h"
 #include "binding/packet_getter.h"
 #include "binding/packet_creator.h"
@@ -28,7 +29,11 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 			const std::optional<float>& score_threshold = std::nullopt,
 			const std::vector<std::string>& category_allowlist = std::vector<std::string>(),
 			const std::vector<std::string>& category_denylist = std::vector<std::string>(),
-			ObjectDetectorResultCallback result_callback = nullptr
+			ObjectDetectorResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			bool output_dense_detections = false,
+			std::shared_ptr<core::tiling_options::TilingOptions> tiling_options = std::shared_ptr<core::tiling_options::TilingOptions>(),
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		)
 			:
 			base_options(base_options),
@@ -38,7 +43,11 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 			score_threshold(score_threshold),
 			category_allowlist(category_allowlist),
 			category_denylist(category_denylist),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			output_dense_detections(output_dense_detections),
+			tiling_options(tiling_options),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::object_detector::proto::ObjectDetectorOptions>> to_pb2() const;
@@ -51,6 +60,13 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 		CV_PROP_RW std::vector<std::string> category_allowlist;
 		CV_PROP_RW std::vector<std::string> category_denylist;
 		CV_PROP_W  ObjectDetectorResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Detections are returned as matrices in dense instead of objects
+		CV_PROP_RW bool output_dense_detections;
+		// Frames are split into tiles run in parallel when set, for small objects in large frames
+		CV_PROP_RW std::shared_ptr<core::tiling_options::TilingOptions> tiling_options;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W ObjectDetector : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -60,10 +76,12 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ObjectDetector>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ObjectDetector>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<ObjectDetector>> create_from_options(std::shared_ptr<ObjectDetectorOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<ObjectDetectorOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<ObjectDetectorResult>> detect(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options =
@@ -81,5 +99,8 @@ namespace mediapipe::tasks::lua::vision::object_detector {
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options =
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
 		);
+	private:
+		bool _output_dense_detections = false;
+		std::shared_ptr<core::tiled_detector::TiledDetector> _tiled_detector;
 	};
 }
@@ -74,7 +74,7 @@ namespace {
 	const std::string _TASK_GRAPH_NAME = "mediapipe.tasks.vision.pose_landmarker.PoseLandmarkerGraph";
 	const int64_t _MICRO_SECONDS_PER_MILLISECOND = 1000;
 
-	[[nodiscard]] absl::StatusOr<std::shared_ptr<PoseLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets) {
+	[[nodiscard]] absl::StatusOr<std::shared_ptr<PoseLandmarkerResult>> _build_landmarker_result(const PacketMap& output_packets, bool landmarks_as_mat) {
 		if (output_packets.at(_NORM_LANDMARKS_STREAM_NAME).IsEmpty()) {
 			return std::make_shared<PoseLandmarkerResult>();
 		}
@@ -90,6 +90,11 @@ namespace {
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& pose_landmarks_proto_list, std::vector<NormalizedLandmarkList>, output_packets.at(_NORM_LANDMARKS_STREAM_NAME));
 		for (const auto& pose_landmarks : pose_landmarks_proto_list) {
+			if (landmarks_as_mat) {
+				pose_landmarker_result->pose_landmarks_mat.push_back(landmark::ToMat(pose_landmarks));
+				continue;
+			}
+
 			std::vector<std::shared_ptr<landmark::NormalizedLandmark>> pose_landmarks_list;
 
 			for (const auto& pose_landmark : pose_landmarks.landmark()) {
@@ -101,6 +106,11 @@ namespace {
 
 		MP_PACKET_ASSIGN_OR_RETURN(const auto& pose_world_landmarks_proto_list, std::vector<LandmarkList>, output_packets.at(_POSE_WORLD_LANDMARKS_STREAM_NAME));
 		for (const auto& pose_world_landmarks : pose_world_landmarks_proto_list) {
+			if (landmarks_as_mat) {
+				pose_landmarker_result->pose_world_landmarks_mat.push_back(landmark::ToMat(pose_world_landmarks));
+				continue;
+			}
+
 			std::vector<std::shared_ptr<landmark::Landmark>> pose_world_landmarks_list;
 
 			for (const auto& pose_world_landmark : pose_world_landmarks.landmark()) {
@@ -139,10 +149,11 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 	absl::StatusOr<std::shared_ptr<PoseLandmarker>> PoseLandmarker::create(
 		const CalculatorGraphConfig& graph_config,
 		VisionTaskRunningMode running_mode,
-		mediapipe::lua::PacketsCallback packet_callback
+		mediapipe::lua::PacketsCallback packet_callback,
+		const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor
 	) {
 		using BaseVisionTaskApi = core::base_vision_task_api::BaseVisionTaskApi;
-		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<PoseLandmarker*>(nullptr));
+		return BaseVisionTaskApi::create(graph_config, running_mode, std::move(packet_callback), static_cast<PoseLandmarker*>(nullptr), executor);
 	}
 
 	absl::StatusOr<std::shared_ptr<PoseLandmarker>> PoseLandmarker::create_from_model_path(const std::string& model_path) {
@@ -154,13 +165,14 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 		PacketsCallback packet_callback = nullptr;
 
 		if (options->result_callback) {
-			packet_callback = [options](const PacketMap& output_packets) {
+			const bool landmarks_as_mat = options->output_landmarks_as_mat;
+			packet_callback = [options, landmarks_as_mat](const PacketMap& output_packets) {
 				const auto& image_out_packet = output_packets.at(_IMAGE_OUT_STREAM_NAME);
 				if (image_out_packet.IsEmpty()) {
 					return;
 				}
 
-				MP_ASSIGN_OR_THROW(auto pose_landmarker_result, _build_landmarker_result(output_packets)); // There is no other choice than throw in a callback to stop the execution
+				MP_ASSIGN_OR_THROW(auto pose_landmarker_result, _build_landmarker_result(output_packets, landmarks_as_mat)); // There is no other choice than throw in a callback to stop the execution
 				MP_PACKET_ASSIGN_OR_THROW(const auto& image, Image, image_out_packet); // There is no other choice than throw in a callback to stop the execution
 				auto timestamp_ms = output_packets.at(_NORM_LANDMARKS_STREAM_NAME).Timestamp().Value() / _MICRO_SECONDS_PER_MILLISECOND;
 
@@ -185,13 +197,22 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 			task_info.output_streams.push_back(_SEGMENTATION_MASK_TAG + ":" + _SEGMENTATION_MASK_STREAM_NAME);
 		}
 
-		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM));
+		MP_ASSIGN_OR_RETURN(auto config, task_info.generate_graph_config(options->running_mode == VisionTaskRunningMode::LIVE_STREAM, options->flow_limiter_options));
 
-		return create(
+		MP_ASSIGN_OR_RETURN(auto task, create(
 			*config,
 			options->running_mode,
-			std::move(packet_callback)
-		);
+			std::move(packet_callback),
+			options->base_options ? options->base_options->executor : nullptr
+		));
+		task->_output_landmarks_as_mat = options->output_landmarks_as_mat;
+		MP_RETURN_IF_ERROR(task->warmup(options->base_options ? options->base_options->warmup_frames : 0));
+		MP_RETURN_IF_ERROR(task->set_motion_gate_options(options->motion_gate_options));
+		return task;
+	}
+
+	std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> PoseLandmarker::create_from_options_async(std::shared_ptr<PoseLandmarkerOptions> options) {
+		return std::make_shared<core::base_vision_task_api::VisionTaskFuture>(options, &PoseLandmarker::create_from_options);
 	}
 
 	absl::StatusOr<std::shared_ptr<PoseLandmarkerResult>> PoseLandmarker::detect(
@@ -201,11 +222,11 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_image_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image))) },
+			{ _IMAGE_IN_STREAM_NAME, std::move(*std::move(create_image(image, false))) },
 			{ _NORM_RECT_STREAM_NAME, std::move(*std::move(create_proto(*normalized_rect.to_pb2()))) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat);
 	}
 
 	absl::StatusOr<std::shared_ptr<PoseLandmarkerResult>> PoseLandmarker::detect_for_video(
@@ -216,7 +237,7 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		MP_ASSIGN_OR_RETURN(auto output_packets, _process_video_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -224,7 +245,7 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 			)) },
 			}));
 
-		return _build_landmarker_result(output_packets);
+		return _build_landmarker_result(output_packets, _output_landmarks_as_mat);
 	}
 
 	absl::Status PoseLandmarker::detect_async(
@@ -235,7 +256,7 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 		MP_ASSIGN_OR_RETURN(auto normalized_rect, convert_to_normalized_rect(image_processing_options, image, false));
 
 		return _send_live_stream_data({
-			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image))->At(
+			{ _IMAGE_IN_STREAM_NAME, std::move(std::move(create_image(image, false))->At(
 				Timestamp(timestamp_ms * _MICRO_SECONDS_PER_MILLISECOND)
 			)) },
 			{ _NORM_RECT_STREAM_NAME, std::move(std::move(create_proto(*normalized_rect.to_pb2()))->At(
@@ -20,22 +20,30 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 		CV_WRAP PoseLandmarkerResult(
 			const std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>>& pose_landmarks = std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>>(),
 			const std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>>& pose_world_landmarks = std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>>(),
-			const std::vector<std::shared_ptr<Image>>& segmentation_masks = std::vector<std::shared_ptr<Image>>()
+			const std::vector<std::shared_ptr<Image>>& segmentation_masks = std::vector<std::shared_ptr<Image>>(),
+			const std::vector<cv::Mat>& pose_landmarks_mat = std::vector<cv::Mat>(),
+			const std::vector<cv::Mat>& pose_world_landmarks_mat = std::vector<cv::Mat>()
 		) :
 			pose_landmarks(pose_landmarks),
 			pose_world_landmarks(pose_world_landmarks),
-			segmentation_masks(segmentation_masks)
+			segmentation_masks(segmentation_masks),
+			pose_landmarks_mat(pose_landmarks_mat),
+			pose_world_landmarks_mat(pose_world_landmarks_mat)
 		{}
 
 		bool operator== (const PoseLandmarkerResult& other) const {
 			return ::mediapipe::lua::__eq__(pose_landmarks, other.pose_landmarks) &&
 				::mediapipe::lua::__eq__(pose_world_landmarks, other.pose_world_landmarks) &&
-				::mediapipe::lua::__eq__(segmentation_masks, other.segmentation_masks);
+				::mediapipe::lua::__eq__(segmentation_masks, other.segmentation_masks) &&
+				::mediapipe::lua::__eq__(pose_landmarks_mat, other.pose_landmarks_mat) &&
+				::mediapipe::lua::__eq__(pose_world_landmarks_mat, other.pose_world_landmarks_mat);
 		}
 
 		CV_PROP_RW std::vector<std::vector<std::shared_ptr<components::containers::landmark::NormalizedLandmark>>> pose_landmarks;
 		CV_PROP_RW std::vector<std::vector<std::shared_ptr<components::containers::landmark::Landmark>>> pose_world_landmarks;
 		CV_PROP_RW std::vector<std::shared_ptr<Image>> segmentation_masks;
+		CV_PROP_RW std::vector<cv::Mat> pose_landmarks_mat;
+		CV_PROP_RW std::vector<cv::Mat> pose_world_landmarks_mat;
 	};
 
 	struct CV_EXPORTS_W_SIMPLE PoseLandmarksConnections {
@@ -66,7 +74,10 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 			float min_pose_presence_confidence = 0.5f,
 			float min_tracking_confidence = 0.5f,
 			bool output_segmentation_masks = false,
-			PoseLandmarkerResultCallback result_callback = nullptr
+			PoseLandmarkerResultCallback result_callback = nullptr,
+			std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options = std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions>(),
+			bool output_landmarks_as_mat = false,
+			std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options = std::shared_ptr<core::motion_gate_options::MotionGateOptions>()
 		) :
 			base_options(base_options),
 			running_mode(running_mode),
@@ -75,7 +86,10 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 			min_pose_presence_confidence(min_pose_presence_confidence),
 			min_tracking_confidence(min_tracking_confidence),
 			output_segmentation_masks(output_segmentation_masks),
-			result_callback(result_callback)
+			result_callback(result_callback),
+			flow_limiter_options(flow_limiter_options),
+			output_landmarks_as_mat(output_landmarks_as_mat),
+			motion_gate_options(motion_gate_options)
 		{}
 
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<mediapipe::tasks::vision::pose_landmarker::proto::PoseLandmarkerGraphOptions>> to_pb2() const;
@@ -88,6 +102,11 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 		CV_PROP_RW float min_tracking_confidence;
 		CV_PROP_RW bool output_segmentation_masks;
 		CV_PROP_W  PoseLandmarkerResultCallback result_callback;
+		CV_PROP_RW std::shared_ptr<lua::core::flow_limiter_options::FlowLimiterOptions> flow_limiter_options;
+		// Landmarks are returned as N x 5 (x, y, z, visibility, presence) float matrices in the *_mat fields instead of objects
+		CV_PROP_RW bool output_landmarks_as_mat;
+		// Video frames nearly identical to the last processed frame reuse its results when set
+		CV_PROP_RW std::shared_ptr<core::motion_gate_options::MotionGateOptions> motion_gate_options;
 	};
 
 	class CV_EXPORTS_W PoseLandmarker : public ::mediapipe::tasks::lua::vision::core::base_vision_task_api::BaseVisionTaskApi {
@@ -97,10 +116,12 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<PoseLandmarker>> create(
 			const CalculatorGraphConfig& graph_config,
 			core::vision_task_running_mode::VisionTaskRunningMode running_mode,
-			mediapipe::lua::PacketsCallback packet_callback = nullptr
+			mediapipe::lua::PacketsCallback packet_callback = nullptr,
+			const std::shared_ptr<mediapipe::lua::shared_executor::SharedExecutor>& executor = nullptr
 		);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<PoseLandmarker>> create_from_model_path(const std::string& model_path);
 		CV_WRAP [[nodiscard]] static absl::StatusOr<std::shared_ptr<PoseLandmarker>> create_from_options(std::shared_ptr<PoseLandmarkerOptions> options);
+		CV_WRAP [[nodiscard]] static std::shared_ptr<core::base_vision_task_api::VisionTaskFuture> create_from_options_async(std::shared_ptr<PoseLandmarkerOptions> options);
 		CV_WRAP [[nodiscard]] absl::StatusOr<std::shared_ptr<PoseLandmarkerResult>> detect(
 			const Image& image,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
@@ -115,5 +136,7 @@ namespace mediapipe::tasks::lua::vision::pose_landmarker {
 			int64_t timestamp_ms,
 			std::shared_ptr<core::image_processing_options::ImageProcessingOptions> image_processing_options = std::shared_ptr<core::image_processing_options::ImageProcessingOptions>()
 		);
+	private:
+		bool _output_landmarks_as_mat = false;
 	};
 }
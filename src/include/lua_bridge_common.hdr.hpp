@@ -155,6 +155,7 @@ namespace LUA_MODULE_NAME {
 	int registerCallbackOnce(Callback callback, void* userdata = nullptr, std::optional<std::function<void(int)>> onRegistration = std::nullopt);
 	bool unregisterCallback(int callback_id);
 	int notifyCallbacks(lua_State* L);
+	int getCallbacksFd(lua_State* L);
 
 
 	// ================================
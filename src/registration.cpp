@@ -1,5 +1,13 @@
 #include <registration.hpp>
 #include <bit.hpp>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
 
 namespace {
 	using namespace LUA_MODULE_NAME;
@@ -81,6 +89,7 @@ namespace {
 
 	const struct luaL_Reg funcs_callbacks[] = {
 		{ "notifyCallbacks",    notifyCallbacks },
+		{ "getCallbacksFd",     getCallbacksFd },
 		{ NULL, NULL }
 	};
 
@@ -100,11 +109,168 @@ namespace {
 	};
 
 	std::map<int, CallbackHandler> registered_callbacks;
-	std::vector<int> once_ids;
-	int _callback_id = 0;
+	std::atomic<int> _callback_id = 0;
 
 	std::shared_timed_mutex callback_mutex;
 
+	// Bounded multi-producer single-consumer ring buffer.
+	// Producers never lock, the consumer is the lua thread.
+	// See https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+	template<typename T, size_t Capacity>
+	class BoundedMPSCQueue {
+		static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+	public:
+		BoundedMPSCQueue() : m_cells(new Cell[Capacity]) {
+			for (size_t i = 0; i < Capacity; i++) {
+				m_cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		bool try_push(T&& value) {
+			Cell* cell;
+			auto pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+			while (true) {
+				cell = &m_cells[pos & (Capacity - 1)];
+				const auto seq = cell->sequence.load(std::memory_order_acquire);
+				const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+				if (diff == 0) {
+					if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						break;
+					}
+				}
+				else if (diff < 0) {
+					// full
+					return false;
+				}
+				else {
+					pos = m_enqueue_pos.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->value = std::move(value);
+			cell->sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool try_pop(T& value) {
+			auto& cell = m_cells[m_dequeue_pos & (Capacity - 1)];
+			const auto seq = cell.sequence.load(std::memory_order_acquire);
+
+			if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(m_dequeue_pos + 1) < 0) {
+				// empty, or the producer of this cell has not finished yet
+				return false;
+			}
+
+			value = std::move(cell.value);
+			cell.value = T();
+			cell.sequence.store(m_dequeue_pos + Capacity, std::memory_order_release);
+			m_dequeue_pos++;
+			return true;
+		}
+
+		// Whether the next cell is published, only meaningful on the consumer thread
+		bool empty() const {
+			const auto& cell = m_cells[m_dequeue_pos & (Capacity - 1)];
+			const auto seq = cell.sequence.load(std::memory_order_acquire);
+			return static_cast<intptr_t>(seq) - static_cast<intptr_t>(m_dequeue_pos + 1) < 0;
+		}
+
+	private:
+		struct Cell {
+			std::atomic<size_t> sequence;
+			T value;
+		};
+
+		std::unique_ptr<Cell[]> m_cells;
+		std::atomic<size_t> m_enqueue_pos = 0;
+		size_t m_dequeue_pos = 0;
+	};
+
+	// Pending once callbacks, typically results of graph threads for the lua thread.
+	// When the ring is full, callbacks go to the overflow list until the lua thread empties it,
+	// which keeps the order of each producer and never blocks a graph thread.
+	BoundedMPSCQueue<CallbackHandler, 1024> pending_callbacks;
+	std::mutex overflow_mutex;
+	std::deque<CallbackHandler> overflow_callbacks;
+	std::atomic<bool> overflowing = false;
+
+	// Readiness notification for lua event loops
+	std::atomic<bool> signaled = false;
+#ifdef __linux__
+	int callbacks_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#else
+	int callbacks_fd = -1;
+#endif
+
+	void signal_callbacks() {
+		if (signaled.exchange(true, std::memory_order_acq_rel)) {
+			return;
+		}
+
+#ifdef __linux__
+		if (callbacks_fd != -1) {
+			uint64_t one = 1;
+			[[maybe_unused]] auto written = write(callbacks_fd, &one, sizeof(one));
+		}
+#endif
+	}
+
+	bool has_pending_callbacks() {
+		return !pending_callbacks.empty() || overflowing.load(std::memory_order_acquire);
+	}
+
+	void clear_callbacks_signal() {
+		// Drain the eventfd before clearing the flag:
+		// a producer that sets the flag after this read writes again and the loop is woken up.
+#ifdef __linux__
+		if (callbacks_fd != -1) {
+			uint64_t count;
+			[[maybe_unused]] auto read_ = read(callbacks_fd, &count, sizeof(count));
+		}
+#endif
+
+		signaled.store(false, std::memory_order_release);
+
+		// A producer that found the flag still set did not write, its callback must not be left unnoticed
+		if (has_pending_callbacks()) {
+			signal_callbacks();
+		}
+	}
+
+	void push_pending_callback(CallbackHandler&& handler) {
+		if (overflowing.load(std::memory_order_acquire) || !pending_callbacks.try_push(std::move(handler))) {
+			std::lock_guard lock(overflow_mutex);
+			overflowing.store(true, std::memory_order_release);
+			overflow_callbacks.push_back(std::move(handler));
+		}
+
+		signal_callbacks();
+	}
+
+	bool pop_pending_callback(CallbackHandler& handler) {
+		if (pending_callbacks.try_pop(handler)) {
+			return true;
+		}
+
+		if (!overflowing.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		std::lock_guard lock(overflow_mutex);
+
+		if (overflow_callbacks.empty()) {
+			overflowing.store(false, std::memory_order_release);
+			return false;
+		}
+
+		handler = std::move(overflow_callbacks.front());
+		overflow_callbacks.pop_front();
+		return true;
+	}
+
 	struct Notifier {
 		static std::shared_timed_mutex notifier_mutex;
 		static bool notifying;
@@ -161,25 +327,29 @@ namespace LUA_MODULE_NAME {
 
 	int registerCallback(Callback callback, void* userdata, std::optional<std::function<void(int)>> onRegistration) {
 		auto lock = lock_callbacks();
+		const auto callback_id = _callback_id++;
 
 		registered_callbacks.emplace(std::piecewise_construct,
-			std::forward_as_tuple(_callback_id),
+			std::forward_as_tuple(callback_id),
 			std::forward_as_tuple(std::move(callback), userdata));
 
 		if (onRegistration) {
-			onRegistration.value()(_callback_id);
+			onRegistration.value()(callback_id);
 		}
 
-		return _callback_id++;
+		return callback_id;
 	}
 
 	int registerCallbackOnce(Callback callback, void* userdata, std::optional<std::function<void(int)>> onRegistration) {
-		return registerCallback(std::move(callback), userdata, std::move([onRegistration](int callback_id) {
-			once_ids.push_back(callback_id);
-			if (onRegistration) {
-				onRegistration.value()(callback_id);
-			}
-			}));
+		const auto callback_id = _callback_id++;
+
+		if (onRegistration) {
+			onRegistration.value()(callback_id);
+		}
+
+		push_pending_callback({ std::move(callback), userdata });
+
+		return callback_id;
 	}
 
 	bool unregisterCallback(int callback_id) {
@@ -194,23 +364,55 @@ namespace LUA_MODULE_NAME {
 	}
 
 	int notifyCallbacks(lua_State* L) {
+		// Optional drain budget, 0 means no limit
+		const auto max_items = luaL_optinteger(L, 1, 0);
+		const auto max_microseconds = luaL_optinteger(L, 2, 0);
+
 		Notifier notify;
+		lua_Integer count = 0;
 
 		// avoid notifyCallbacks while already in notifyCallbacks
 		if (notify) {
-			auto lock = lock_callbacks();
+			{
+				auto lock = lock_callbacks();
+
+				for (const auto& [callback_id, value] : registered_callbacks) {
+					const auto& [callback, userdata] = value;
+					callback(L, userdata);
+				}
+			}
 
-			for (const auto& [callback_id, value] : registered_callbacks) {
-				const auto& [callback, userdata] = value;
-				callback(L, userdata);
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(max_microseconds);
+
+			bool drained = true;
+			CallbackHandler handler;
+			while (pop_pending_callback(handler)) {
+				handler.callback(L, handler.userdata);
+				handler = CallbackHandler();
+				count++;
+
+				if ((max_items > 0 && count >= max_items) || (max_microseconds > 0 && std::chrono::steady_clock::now() >= deadline)) {
+					// The budget may run out on the last pending callback
+					drained = !has_pending_callbacks();
+					break;
+				}
 			}
 
-			for (const auto& callback_id : once_ids) {
-				registered_callbacks.erase(callback_id);
+			if (drained) {
+				clear_callbacks_signal();
+			} else {
+				// Keep the event loop signaled for the remaining callbacks
+				signal_callbacks();
 			}
 		}
 
-		return 0;
+		lua_pushinteger(L, count);
+		return 1;
+	}
+
+	int getCallbacksFd(lua_State* L) {
+		lua_pushinteger(L, callbacks_fd);
+		return 1;
 	}
 }
 
@@ -193,6 +193,113 @@ local function test_sequence_input(self)
     end
 end
 
+local function test_notify_callbacks_budget(self)
+    local text_config = [[
+        input_stream: 'in'
+        output_stream: 'out'
+        node {
+            calculator: 'PassThroughCalculator'
+            input_stream: 'in'
+            output_stream: 'out'
+        }
+    ]]
+    local hello_world_packet = packet_creator.create_string('hello world')
+    local out = {}
+    local graph = CalculatorGraph(mediapipe_lua.kwargs({ graph_config = text_config }))
+    graph:observe_output_stream('out', function(_, packet) out[#out + 1] = packet end)
+    graph:start_run()
+    mediapipe_lua.notifyCallbacks()
+
+    local sequence_size = 10
+    for i = 0, sequence_size - 1 do
+        graph:add_packet_to_input_stream(mediapipe_lua.kwargs({
+            stream = 'in', packet = hello_world_packet, timestamp = i }))
+    end
+    graph:wait_until_idle()
+
+    -- at most max_items callbacks are run per call, in order
+    self.assertEqual(mediapipe_lua.notifyCallbacks(3), 3)
+    self.assertLen(out, 3)
+    self.assertEqual(mediapipe_lua.notifyCallbacks(3), 3)
+    self.assertLen(out, 6)
+    self.assertEqual(mediapipe_lua.notifyCallbacks(), sequence_size - 6)
+    self.assertLen(out, sequence_size)
+    self.assertEqual(mediapipe_lua.notifyCallbacks(), 0)
+
+    for i = 0, sequence_size - 1 do
+        self.assertEqual(out[i + INDEX_BASE].timestamp.value, i)
+    end
+
+    graph:close()
+end
+
+-- Returns the counter of the eventfd, or nil where /proc is not available
+local function read_eventfd_count(fd)
+    local f = io.open('/proc/self/fdinfo/' .. fd, 'r')
+    if f == nil then
+        return nil
+    end
+    local fdinfo = f:read('*all')
+    f:close()
+    local count = fdinfo:match('eventfd%-count:%s*(%x+)')
+    return count and tonumber(count, 16)
+end
+
+local function test_callbacks_fd(self)
+    local fd = mediapipe_lua.getCallbacksFd()
+    self.assertEqual(type(fd), 'number')
+    if fd == -1 or read_eventfd_count(fd) == nil then
+        -- eventfd is only available on linux
+        return
+    end
+
+    local text_config = [[
+        input_stream: 'in'
+        output_stream: 'out'
+        node {
+            calculator: 'PassThroughCalculator'
+            input_stream: 'in'
+            output_stream: 'out'
+        }
+    ]]
+    local out = {}
+    local graph = CalculatorGraph(mediapipe_lua.kwargs({ graph_config = text_config }))
+    graph:observe_output_stream('out', function(_, packet) out[#out + 1] = packet end)
+    graph:start_run()
+
+    mediapipe_lua.notifyCallbacks()
+    self.assertEqual(read_eventfd_count(fd), 0)
+
+    -- the fd becomes readable when callbacks are pending
+    for i = 0, 1 do
+        graph:add_packet_to_input_stream(mediapipe_lua.kwargs({
+            stream = 'in', packet = packet_creator.create_int(i), timestamp = i }))
+    end
+    graph:wait_until_idle()
+    self.assertTrue(read_eventfd_count(fd) > 0)
+
+    -- it stays readable while the drain budget leaves callbacks pending
+    self.assertEqual(mediapipe_lua.notifyCallbacks(1), 1)
+    self.assertTrue(read_eventfd_count(fd) > 0)
+
+    -- and is reset once the queue is empty
+    self.assertEqual(mediapipe_lua.notifyCallbacks(), 1)
+    self.assertEqual(read_eventfd_count(fd), 0)
+    self.assertLen(out, 2)
+
+    -- or when the budget runs out on the last pending callback
+    graph:add_packet_to_input_stream(mediapipe_lua.kwargs({
+        stream = 'in', packet = packet_creator.create_int(2), timestamp = 2 }))
+    graph:wait_until_idle()
+    self.assertTrue(read_eventfd_count(fd) > 0)
+    self.assertEqual(mediapipe_lua.notifyCallbacks(1), 1)
+    self.assertEqual(read_eventfd_count(fd), 0)
+    self.assertLen(out, 3)
+
+    graph:close()
+    mediapipe_lua.notifyCallbacks()
+end
+
 describe("GraphTest", function()
     it("should test_graph_initialized_with_proto_config", function()
         test_graph_initialized_with_proto_config(_assert)
@@ -209,4 +316,10 @@ describe("GraphTest", function()
     it("should test_sequence_input", function()
         test_sequence_input(_assert)
     end)
+    it("should test_notify_callbacks_budget", function()
+        test_notify_callbacks_budget(_assert)
+    end)
+    it("should test_callbacks_fd", function()
+        test_callbacks_fd(_assert)
+    end)
 end)
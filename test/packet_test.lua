@@ -30,11 +30,14 @@ local calculator_graph = mediapipe.lua._framework_bindings.calculator_graph
 local image = mediapipe.lua._framework_bindings.image
 local image_frame = mediapipe.lua._framework_bindings.image_frame
 local packet = mediapipe.lua._framework_bindings.packet
+local audio_data_module = mediapipe.tasks.lua.components.containers.audio_data
 
 local CalculatorGraph = calculator_graph.CalculatorGraph
 local Image = image.Image
 local ImageFormat = image_frame.ImageFormat
 local ImageFrame = image_frame.ImageFrame
+local AudioData = audio_data_module.AudioData
+local AudioDataFormat = audio_data_module.AudioDataFormat
 
 local function test_empty_packet(self)
     local p = packet.Packet()
@@ -140,6 +143,11 @@ local function test_detection_proto_packet(self)
     local proto_packet = packet_creator.create_proto(detection)
 
     local output_proto = packet_getter.get_proto(proto_packet)
+    self.assertEqual(output_proto, detection)
+
+    -- writing the returned message leaves the packet content unchanged
+    text_format.Parse("score: 0.7", output_proto)
+    self.assertEqual(packet_getter.get_proto(proto_packet), detection)
 
     local p = packet_creator.create_proto(detection):at(100)
     self.assertEqual(p.timestamp.value, 100)
@@ -194,6 +202,51 @@ local function test_float_vector_packet(self)
     self.assertEqual(p.timestamp.value, 100)
 end
 
+local function test_matrix_packet(self)
+    local data = cv2.Mat.createFromArray({ { 1, 2, 3 }, { 4, 5, 6 } }, cv2.CV_32F)
+    self.assertMatEqual(packet_getter.get_matrix(packet_creator.create_matrix(data)), data)
+    self.assertMatEqual(packet_getter.get_matrix(packet_creator.create_matrix(data, true)), cv2.transpose(data))
+end
+
+local function _create_wrapped_audio_data()
+    -- A stereo buffer of 4 samples, the second load wraps around the end of its storage.
+    local audio_data = AudioData(4, AudioDataFormat(2))
+    audio_data:load_from_mat(cv2.Mat.createFromArray({ { 1, 10 }, { 2, 20 }, { 3, 30 } }, cv2.CV_32F))
+    audio_data:load_from_mat(cv2.Mat.createFromArray({ { 4, 40 }, { 5, 50 }, { 6, 60 } }, cv2.CV_32F))
+    return audio_data
+end
+
+local _WRAPPED_AUDIO_SAMPLES = { { 3, 30 }, { 4, 40 }, { 5, 50 }, { 6, 60 } }
+
+local function test_wrapped_audio_data_buffer(self)
+    local audio_data = _create_wrapped_audio_data()
+    local expected = cv2.Mat.createFromArray(_WRAPPED_AUDIO_SAMPLES, cv2.CV_32F):reshape(2)
+
+    -- Samples are ordered from the oldest to the newest.
+    local buffer = audio_data.buffer
+    self.assertMatEqual(buffer, expected)
+
+    -- The buffer of wrapped audio data is a copy.
+    buffer:setTo(0)
+    self.assertMatEqual(audio_data.buffer, expected)
+end
+
+local function test_wrapped_audio_data_matrix_packet(self)
+    local audio_data = _create_wrapped_audio_data()
+    local expected = cv2.transpose(cv2.Mat.createFromArray(_WRAPPED_AUDIO_SAMPLES, cv2.CV_32F))
+
+    -- The oldest samples are at the end of the storage, the newest ones at its start.
+    local segments = audio_data:segments()
+    self.assertLen(segments, 2)
+    self.assertEqual(segments[0 + INDEX_BASE].rows, 2)
+    self.assertEqual(segments[1 + INDEX_BASE].rows, 2)
+
+    -- Segments are stacked in order, channels x samples as audio tasks expect them.
+    local p = packet_creator.create_matrix_from_blocks(segments, true)
+    self.assertMatEqual(packet_getter.get_matrix(p), expected)
+    self.assertMatEqual(packet_getter.get_matrix(packet_creator.create_matrix(audio_data.buffer, true)), expected)
+end
+
 local function test_image_vector_packet(self)
     local w, h, offset = 80, 40, 10
     local mat = _mat_utils.randomImage(w, h, cv2.CV_8UC3, 0, 2 ^ 8)
@@ -427,6 +480,20 @@ local function test_image_packet_creation_reference_mode(self)
         packet_getter.get_image(output_packet):mat_view(), rgb_data_copy)
 end
 
+local function test_image_packet_from_image_reference_mode(self)
+    local w, h, channels = math.random(3, 100), math.random(3, 100), 3
+    local rgb_data = _mat_utils.randomImage(w, h, cv2.CV_MAKETYPE(cv2.CV_8U, channels), 0, 2 ^ 8)
+    local image = Image(mediapipe_lua.kwargs({ image_format = ImageFormat.SRGB, data = rgb_data }))
+    local image_packet = packet_creator.create_image(mediapipe_lua.kwargs({ data = image, copy = false }))
+    image = nil
+    collectgarbage()
+    -- The packet shares the pixel data of the image and keeps it alive.
+    local output_image = packet_getter.get_image(image_packet)
+    self.assertEqual(output_image.height, h)
+    self.assertEqual(output_image.width, w)
+    self.assertMatEqual(output_image:mat_view(), rgb_data)
+end
+
 local function test_image_packet_copy_creation_with_cropping(self)
     local w, h = math.random(40, 100), math.random(40, 100)
     local channels, offset = 3, 10
@@ -528,6 +595,15 @@ describe("PacketTest", function()
     it("should test_float_image_frame_packet", function()
         test_float_image_frame_packet(_assert)
     end)
+    it("should test_matrix_packet", function()
+        test_matrix_packet(_assert)
+    end)
+    it("should test_wrapped_audio_data_buffer", function()
+        test_wrapped_audio_data_buffer(_assert)
+    end)
+    it("should test_wrapped_audio_data_matrix_packet", function()
+        test_wrapped_audio_data_matrix_packet(_assert)
+    end)
     it("should test_image_frame_packet_creation_copy_mode", function()
         test_image_frame_packet_creation_copy_mode(_assert)
     end)
@@ -543,6 +619,9 @@ describe("PacketTest", function()
     it("should test_image_packet_creation_reference_mode", function()
         test_image_packet_creation_reference_mode(_assert)
     end)
+    it("should test_image_packet_from_image_reference_mode", function()
+        test_image_packet_from_image_reference_mode(_assert)
+    end)
     it("should test_image_packet_copy_creation_with_cropping", function()
         test_image_packet_copy_creation_with_cropping(_assert)
     end)
@@ -27,6 +27,10 @@ local detection_pb2 = mediapipe.framework.formats.detection_pb2
 local time_series_header_pb2 = mediapipe.framework.formats.time_series_header_pb2
 local solution_base = mediapipe.lua.solution_base
 local PacketDataType = mediapipe.lua.solution_base.PacketDataType
+local SolutionPool = mediapipe.lua.solution_pool.SolutionPool
+local DispatchPolicy = mediapipe.lua.instance_pool.DispatchPolicy
+local graph_config_cache = mediapipe.lua.graph_config_cache
+local SharedExecutor = mediapipe.lua.shared_executor.SharedExecutor
 
 local CALCULATOR_OPTIONS_TEST_GRAPH_CONFIG = [[
     input_stream: 'image_in'
@@ -210,6 +214,196 @@ local function test_solution_reset(self, id, text_config, side_inputs)
     end
 end
 
+local function test_solution_pipelined(self, id, text_config, side_inputs)
+    local config_proto = text_format.Parse(text_config,
+        calculator_pb2.CalculatorGraphConfig())
+    local solution = solution_base.SolutionBase(mediapipe_lua.kwargs({
+        graph_config = config_proto,
+        side_inputs = side_inputs,
+        extra_settings = solution_base.ExtraSettings(mediapipe_lua.kwargs({ max_in_flight = 4 }))
+    }))
+    self.assertEqual(solution:get_max_in_flight(), 4)
+
+    local input_images = {}
+    for i = 1, 20 do
+        input_images[i] = _mat_utils.randomImage(3, 3, cv2.CV_8UC3, 0, 27)
+    end
+
+    -- submit/poll: outputs come back in submission order
+    local polled = 0
+    for i = 1, 10 do
+        solution:submit(input_images[i])
+        local ready, outputs = solution:poll()
+        if ready then
+            polled = polled + 1
+            self.assertMatEqual(input_images[polled], outputs.image_out)
+        end
+    end
+
+    while polled < 10 do
+        local ready, outputs = solution:poll(mediapipe_lua.kwargs({ block = true }))
+        self.assertTrue(ready)
+        polled = polled + 1
+        self.assertMatEqual(input_images[polled], outputs.image_out)
+    end
+
+    local ready = solution:poll()
+    self.assertFalse(ready)
+
+    -- submit/drain
+    for i = 11, 20 do
+        solution:submit({ ['image_in'] = input_images[i] })
+    end
+
+    local outputs_list = solution:drain()
+    self.assertLen(outputs_list, 10)
+    for i = 1, 10 do
+        self.assertMatEqual(input_images[10 + i], outputs_list[i].image_out)
+    end
+
+    -- synchronous processing still works once drained
+    local outputs = solution:process(input_images[1])
+    self.assertMatEqual(input_images[1], outputs.image_out)
+end
+
+local function test_solution_pool(self, text_config, dispatch_policy, from_options)
+    local config_proto = text_format.Parse(text_config,
+        calculator_pb2.CalculatorGraphConfig())
+    local pool
+    if from_options then
+        pool = SolutionPool.create(config_proto, 3, mediapipe_lua.kwargs({ dispatch_policy = dispatch_policy }))
+    else
+        local solutions = {}
+        for i = 1, 3 do
+            solutions[i] = solution_base.SolutionBase(mediapipe_lua.kwargs({ graph_config = config_proto }))
+        end
+        pool = SolutionPool.create(solutions, dispatch_policy)
+    end
+    self.assertEqual(pool:get_num_instances(), 3)
+
+    local input_images = {}
+    for i = 1, 20 do
+        input_images[i] = _mat_utils.randomImage(3, 3, cv2.CV_8UC3, 0, 27)
+    end
+
+    -- submit/poll: outputs come back in submission order
+    for i = 1, 10 do
+        pool:submit(input_images[i])
+    end
+    self.assertEqual(pool:get_num_pending(), 10)
+
+    for i = 1, 10 do
+        local ready, outputs, request_id = pool:poll(mediapipe_lua.kwargs({ block = true }))
+        self.assertTrue(ready)
+        self.assertEqual(request_id, i - 1)
+        self.assertMatEqual(input_images[i], outputs.image_out)
+    end
+
+    local ready = pool:poll()
+    self.assertFalse(ready)
+
+    -- submit/drain
+    for i = 11, 20 do
+        pool:submit({ ['image_in'] = input_images[i] })
+    end
+
+    local outputs_list = pool:drain()
+    self.assertLen(outputs_list, 10)
+    for i = 1, 10 do
+        self.assertMatEqual(input_images[10 + i], outputs_list[i].image_out)
+    end
+    self.assertEqual(pool:get_num_pending(), 0)
+end
+
+local function test_solution_graph_config_cache(self)
+    local config_proto = text_format.Parse(CALCULATOR_OPTIONS_TEST_GRAPH_CONFIG,
+        calculator_pb2.CalculatorGraphConfig())
+    config_proto.node[0]:ClearField('options')
+    config_proto.node[0]:ClearField('node_options')
+    local input_image = _mat_utils.randomImage(3, 3, cv2.CV_8UC3, 0, 27)
+
+    graph_config_cache.clear()
+    self.assertEqual(graph_config_cache.size(), 0)
+
+    -- the second solution reuses the expanded config of the first one
+    for _ = 1, 2 do
+        local solution = solution_base.SolutionBase(mediapipe_lua.kwargs({ graph_config = config_proto }))
+        self.assertEqual(graph_config_cache.size(), 1)
+        local outputs = solution:process(input_image)
+        self.assertMatEqual(input_image, outputs.image_out)
+    end
+
+    -- a different interface is a different entry
+    solution_base.SolutionBase(mediapipe_lua.kwargs({ graph_config = config_proto, outputs = { 'image_out' } }))
+    self.assertEqual(graph_config_cache.size(), 2)
+
+    graph_config_cache.clear()
+end
+
+local function test_solution_shared_executor(self)
+    local config_proto = text_format.Parse(CALCULATOR_OPTIONS_TEST_GRAPH_CONFIG,
+        calculator_pb2.CalculatorGraphConfig())
+    config_proto.node[0]:ClearField('options')
+    config_proto.node[0]:ClearField('node_options')
+
+    local executor = SharedExecutor.create(2)
+    self.assertEqual(executor:get_num_threads(), 2)
+
+    local solutions = {}
+    for i = 1, 3 do
+        solutions[i] = solution_base.SolutionBase(mediapipe_lua.kwargs({
+            graph_config = config_proto,
+            extra_settings = solution_base.ExtraSettings(mediapipe_lua.kwargs({ executor = executor }))
+        }))
+    end
+
+    for _ = 1, 5 do
+        for i = 1, 3 do
+            local input_image = _mat_utils.randomImage(3, 3, cv2.CV_8UC3, 0, 27)
+            self.assertMatEqual(input_image, solutions[i]:process(input_image).image_out)
+        end
+    end
+
+    for i = 1, 3 do
+        solutions[i]:close()
+    end
+
+    -- solutions created without an executor run on the default one
+    SharedExecutor.set_default(executor)
+    local solution = solution_base.SolutionBase(mediapipe_lua.kwargs({ graph_config = config_proto }))
+    local input_image = _mat_utils.randomImage(3, 3, cv2.CV_8UC3, 0, 27)
+    self.assertMatEqual(input_image, solution:process(input_image).image_out)
+    solution:close()
+    SharedExecutor.set_default(nil)
+end
+
+local function test_solution_image_outputs_outlive_graph(self, writable_outputs)
+    local config_proto = text_format.Parse(CALCULATOR_OPTIONS_TEST_GRAPH_CONFIG,
+        calculator_pb2.CalculatorGraphConfig())
+    config_proto.node[0]:ClearField('options')
+    config_proto.node[0]:ClearField('node_options')
+    local solution = solution_base.SolutionBase(mediapipe_lua.kwargs({
+        graph_config = config_proto,
+        extra_settings = solution_base.ExtraSettings(mediapipe_lua.kwargs({
+            writable_outputs = writable_outputs
+        }))
+    }))
+
+    local input_images = {}
+    local output_images = {}
+    for i = 1, 5 do
+        input_images[i] = _mat_utils.randomImage(3, 3, cv2.CV_8UC3, 0, 27)
+        output_images[i] = solution:process(input_images[i]).image_out
+    end
+    solution:close()
+    solution = nil
+    collectgarbage()
+
+    for i = 1, 5 do
+        self.assertMatEqual(input_images[i], output_images[i])
+    end
+end
+
 local function test_solution_stream_type_hints(self)
     local text_config = [[
         input_stream: 'union_type_image_in'
@@ -325,6 +519,11 @@ function _assert._process_and_verify(self, ...)
     local outputs2 = solution:process({ ['image_in'] = input_image })
     self.assertMatEqual(input_image, outputs.image_out)
     self.assertMatEqual(input_image, outputs2.image_out)
+
+    self.assertEqual(solution:get_input_stream_names()[1], 'image_in')
+    self.assertEqual(solution:get_output_stream_names()[1], 'image_out')
+    local outputs3 = solution:process_indexed({ input_image })
+    self.assertMatEqual(input_image, outputs3[1])
 end
 
 describe("SolutionBaseTest", function()
@@ -442,6 +641,55 @@ describe("SolutionBaseTest", function()
         end)
     end
 
+    it("should test_solution_pipelined", function()
+        test_solution_pipelined(_assert, 'graph_without_side_packets', [[
+            input_stream: 'image_in'
+            output_stream: 'image_out'
+            node {
+                calculator: 'ImageTransformationCalculator'
+                input_stream: 'IMAGE:image_in'
+                output_stream: 'IMAGE:transformed_image_in'
+            }
+            node {
+                calculator: 'ImageTransformationCalculator'
+                input_stream: 'IMAGE:transformed_image_in'
+                output_stream: 'IMAGE:image_out'
+            }
+        ]])
+    end)
+
+    it("should test_solution_pool", function()
+        local text_config = [[
+            input_stream: 'image_in'
+            output_stream: 'image_out'
+            node {
+                calculator: 'ImageTransformationCalculator'
+                input_stream: 'IMAGE:image_in'
+                output_stream: 'IMAGE:image_out'
+            }
+        ]]
+        for _, from_options in ipairs({ false, true }) do
+            test_solution_pool(_assert, text_config, DispatchPolicy.ROUND_ROBIN, from_options)
+            test_solution_pool(_assert, text_config, DispatchPolicy.LEAST_LOADED, from_options)
+        end
+
+        local config_proto = text_format.Parse(text_config, calculator_pb2.CalculatorGraphConfig())
+        _assert.assertFalse(pcall(SolutionPool.create, config_proto, 0))
+    end)
+
+    it("should test_solution_graph_config_cache", function()
+        test_solution_graph_config_cache(_assert)
+    end)
+
+    it("should test_solution_shared_executor", function()
+        test_solution_shared_executor(_assert)
+    end)
+
+    it("should test_solution_image_outputs_outlive_graph", function()
+        test_solution_image_outputs_outlive_graph(_assert, false)
+        test_solution_image_outputs_outlive_graph(_assert, true)
+    end)
+
     it("should test_solution_stream_type_hints", function()
         test_solution_stream_type_hints(_assert)
     end)
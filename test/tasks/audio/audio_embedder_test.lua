@@ -0,0 +1,122 @@
+#!/usr/bin/env lua
+
+require "busted.runner" ()
+
+package.path = arg[0]:gsub("[^/\\]+%.lua", '?.lua;'):gsub('/', package.config:sub(1, 1)) ..
+        arg[0]:gsub("[^/\\]+%.lua", '../../?.lua;'):gsub('/', package.config:sub(1, 1)) .. package.path
+
+local INDEX_BASE = 1 -- lua is 1-based indexed
+
+local _assert = require("_assert")
+local test_utils = require("test_utils")
+
+local mediapipe_lua = require("mediapipe_lua")
+local mediapipe = mediapipe_lua.mediapipe
+
+local opencv_lua = require("opencv_lua")
+local cv2 = opencv_lua.cv
+
+local audio_data_module = mediapipe.tasks.lua.components.containers.audio_data
+local audio_file_reader_module = mediapipe.tasks.lua.components.containers.audio_file_reader
+local base_options_module = mediapipe.tasks.lua.core.base_options
+local audio_embedder = mediapipe.tasks.lua.audio.audio_embedder
+
+local _AudioData = audio_data_module.AudioData
+local _AudioEmbedder = audio_embedder.AudioEmbedder
+local _AudioEmbedderOptions = audio_embedder.AudioEmbedderOptions
+local _AudioFileReader = audio_file_reader_module.AudioFileReader
+local _BaseOptions = base_options_module.BaseOptions
+local _SharedExecutor = mediapipe.lua.shared_executor.SharedExecutor
+
+local _YAMNET_EMBEDDING_MODEL_FILE = 'yamnet_embedding_metadata.tflite'
+local _SPEECH_WAV_16K_MONO = 'speech_16000_hz_mono.wav'
+local _TEST_DATA_DIR = test_utils.get_resource_dir() .. '/mediapipe/tasks/testdata/audio'
+-- Number of frames of the yamnet input window
+local _YAMNET_NUM_SAMPLES = 15600
+-- Tolerance for embedding vector coordinate values.
+local _EPSILON = 1e-4
+
+local function setUp(self)
+    test_utils.download_test_files(_TEST_DATA_DIR, {
+        _YAMNET_EMBEDDING_MODEL_FILE,
+        _SPEECH_WAV_16K_MONO,
+    })
+    self.model_path = test_utils.get_test_data_path(_YAMNET_EMBEDDING_MODEL_FILE)
+    self.audio_path = test_utils.get_test_data_path(_SPEECH_WAV_16K_MONO)
+end
+
+function _assert._read_clips(self, num_clips)
+    -- Splits the test file into clips of one to num_clips input windows.
+    local reader = _AudioFileReader.open_wav(self.audio_path)
+    local audio_clips = {}
+    for i = 1, num_clips do
+        local audio_clip = reader:read(i * _YAMNET_NUM_SAMPLES)
+        if audio_clip == nil then
+            break
+        end
+        audio_clips[i] = audio_clip
+    end
+    self.assertGreater(#audio_clips, 1)
+    return audio_clips
+end
+
+local function test_embed_batch(self, num_workers)
+    -- Creates embedder on its own executor.
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({
+        model_asset_path = self.model_path,
+        executor = _SharedExecutor.create(2),
+    }))
+    local options = _AudioEmbedderOptions(mediapipe_lua.kwargs({ base_options = base_options }))
+    local embedder = _AudioEmbedder.create_from_options(options)
+
+    -- Results are returned in input order, whatever the instance that embedded them.
+    local audio_clips = self:_read_clips(4)
+    local output_lists = embedder:embed_batch(audio_clips, num_workers)
+    self.assertLen(output_lists, #audio_clips)
+
+    for i, audio_clip in ipairs(audio_clips) do
+        local expected_list = embedder:embed(audio_clip)
+        self.assertLen(output_lists[i], #expected_list)
+        for j, expected in ipairs(expected_list) do
+            local result = output_lists[i][j]
+            self.assertEqual(result.timestamp_ms, expected.timestamp_ms)
+            self.assertLess(cv2.norm(
+                result.embeddings[0 + INDEX_BASE].embedding,
+                expected.embeddings[0 + INDEX_BASE].embedding,
+                cv2.NORM_INF
+            ), _EPSILON)
+        end
+    end
+end
+
+local function test_embed_batch_fails_with_invalid_input(self)
+    local embedder = _AudioEmbedder.create_from_model_path(self.model_path)
+    local audio_clips = self:_read_clips(2)
+
+    -- Every clip needs a sample rate.
+    self.assertFalse(pcall(function()
+        embedder:embed_batch({ audio_clips[1], _AudioData(_YAMNET_NUM_SAMPLES), audio_clips[2] }, 2)
+    end))
+
+    -- The number of workers cannot be negative.
+    self.assertFalse(pcall(function()
+        embedder:embed_batch(audio_clips, -1)
+    end))
+
+    -- The embedder is still usable after a failed batch.
+    self.assertLen(embedder:embed_batch(audio_clips, 2), #audio_clips)
+end
+
+describe("AudioEmbedderTest", function()
+    setUp(_assert)
+
+    for _, num_workers in ipairs({ 0, 1, 3 }) do
+        it("should test_embed_batch " .. num_workers, function()
+            test_embed_batch(_assert, num_workers)
+        end)
+    end
+
+    it("should test_embed_batch_fails_with_invalid_input", function()
+        test_embed_batch_fails_with_invalid_input(_assert)
+    end)
+end)
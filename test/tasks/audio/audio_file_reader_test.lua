@@ -0,0 +1,210 @@
+#!/usr/bin/env lua
+
+require "busted.runner" ()
+
+package.path = arg[0]:gsub("[^/\\]+%.lua", '?.lua;'):gsub('/', package.config:sub(1, 1)) ..
+        arg[0]:gsub("[^/\\]+%.lua", '../../?.lua;'):gsub('/', package.config:sub(1, 1)) .. package.path
+
+local unpack = table.unpack or unpack ---@diagnostic disable-line: deprecated
+
+local _assert = require("_assert")
+local _mat_utils = require("_mat_utils") ---@diagnostic disable-line: unused-local
+local test_utils = require("test_utils")
+
+local mediapipe_lua = require("mediapipe_lua")
+local mediapipe = mediapipe_lua.mediapipe
+
+local opencv_lua = require("opencv_lua")
+local cv2 = opencv_lua.cv
+
+local audio_data_module = mediapipe.tasks.lua.components.containers.audio_data
+local audio_file_reader_module = mediapipe.tasks.lua.components.containers.audio_file_reader
+
+local _AudioData = audio_data_module.AudioData
+local _AudioDataFormat = audio_data_module.AudioDataFormat
+local _AudioFileReader = audio_file_reader_module.AudioFileReader
+
+local _WAVE_FORMAT_PCM = 0x0001
+local _WAVE_FORMAT_IEEE_FLOAT = 0x0003
+local _SAMPLE_RATE = 16000
+
+-- Little endian encodings, string.pack is not available before lua 5.3
+local function _u16(value)
+    return string.char(value % 256, math.floor(value / 256) % 256)
+end
+
+local function _u32(value)
+    local bytes = {}
+    for i = 1, 4 do
+        bytes[i] = value % 256
+        value = math.floor(value / 256)
+    end
+    return string.char(unpack(bytes))
+end
+
+local function _pcm16(samples)
+    local data = {}
+    for i, sample in ipairs(samples) do
+        data[i] = _u16(sample < 0 and sample + 2 ^ 16 or sample)
+    end
+    return table.concat(data)
+end
+
+local function _pcm32(samples)
+    local data = {}
+    for i, sample in ipairs(samples) do
+        data[i] = _u32(sample < 0 and sample + 2 ^ 32 or sample)
+    end
+    return table.concat(data)
+end
+
+local function _fmt_chunk(format_tag, num_channels, bits_per_sample, extensible)
+    local block_align = num_channels * math.floor(bits_per_sample / 8)
+    local body = _u16(extensible and 0xFFFE or format_tag) .. _u16(num_channels) .. _u32(_SAMPLE_RATE) ..
+        _u32(_SAMPLE_RATE * block_align) .. _u16(block_align) .. _u16(bits_per_sample)
+    if extensible then
+        -- extension size, valid bits, channel mask, then the sub format GUID, which starts with the format tag
+        body = body .. _u16(22) .. _u16(bits_per_sample) .. _u32(0) .. _u16(format_tag) .. string.rep('\0', 14)
+    end
+    return 'fmt ' .. _u32(#body) .. body
+end
+
+local function _write_file(name, content)
+    local path = test_utils.get_resource_dir() .. '/audio_file_reader_test_' .. name .. '.wav'
+    local f = io.open(path, 'wb')
+    f:write(content)
+    f:close()
+    return path
+end
+
+-- Writes a WAV file and returns its path.
+-- An odd sized chunk can be inserted before the data chunk, and the data size left unset like streaming writers do.
+local function _write_wav(name, fmt_chunk, data, odd_chunk, unset_data_size)
+    local chunks = fmt_chunk
+    if odd_chunk then
+        chunks = chunks .. 'LIST' .. _u32(3) .. 'abc' .. '\0'
+    end
+    chunks = chunks .. 'data' .. _u32(unset_data_size and 0 or #data) .. data
+    return _write_file(name, 'RIFF' .. _u32(4 + #chunks) .. 'WAVE' .. chunks)
+end
+
+function _assert._expect_samples_equal(self, reader, num_channels, expected_samples)
+    self.assertEqual(reader.num_frames, #expected_samples)
+    self.assertEqual(reader.audio_format.num_channels, num_channels)
+    self.assertEqual(reader.audio_format.sample_rate, _SAMPLE_RATE)
+
+    local audio_block = reader:read(#expected_samples + 1)
+    local expected = cv2.Mat.createFromArray(expected_samples, cv2.CV_32F):reshape(num_channels)
+    self.assertMatAlmostEqual(audio_block.buffer, expected)
+    self.assertEqual(reader.position, #expected_samples)
+    self.assertIsNone(reader:read(1))
+end
+
+local function test_open_wav_pcm16(self)
+    local data = _pcm16({ 0, 16384, -16384, 32767, -32768, 8192 })
+    local path = _write_wav('pcm16', _fmt_chunk(_WAVE_FORMAT_PCM, 2, 16), data)
+    self:_expect_samples_equal(_AudioFileReader.open_wav(path), 2, {
+        { 0, 0.5 },
+        { -0.5, 32767 / 32768 },
+        { -1, 0.25 },
+    })
+    os.remove(path)
+end
+
+local function test_open_wav_pcm32(self)
+    local data = _pcm32({ 0, 2 ^ 30, -2 ^ 30, -2 ^ 31 })
+    local path = _write_wav('pcm32', _fmt_chunk(_WAVE_FORMAT_PCM, 1, 32), data)
+    self:_expect_samples_equal(_AudioFileReader.open_wav(path), 1, { { 0 }, { 0.5 }, { -0.5 }, { -1 } })
+    os.remove(path)
+end
+
+local function test_open_wav_float(self)
+    -- IEEE 754 encodings of 0.5, -0.25, 0.75 and -1
+    local data = _u32(0x3F000000) .. _u32(0xBE800000) .. _u32(0x3F400000) .. _u32(0xBF800000)
+    local path = _write_wav('float', _fmt_chunk(_WAVE_FORMAT_IEEE_FLOAT, 1, 32), data)
+    self:_expect_samples_equal(_AudioFileReader.open_wav(path), 1, { { 0.5 }, { -0.25 }, { 0.75 }, { -1 } })
+    os.remove(path)
+end
+
+local function test_open_wav_extensible(self)
+    local data = _pcm16({ 16384, -16384 })
+    local path = _write_wav('extensible', _fmt_chunk(_WAVE_FORMAT_PCM, 1, 16, true), data)
+    self:_expect_samples_equal(_AudioFileReader.open_wav(path), 1, { { 0.5 }, { -0.5 } })
+    os.remove(path)
+end
+
+local function test_open_wav_skips_odd_sized_chunk(self)
+    local data = _pcm16({ 16384, -16384 })
+    local path = _write_wav('odd_chunk', _fmt_chunk(_WAVE_FORMAT_PCM, 1, 16), data, true)
+    self:_expect_samples_equal(_AudioFileReader.open_wav(path), 1, { { 0.5 }, { -0.5 } })
+    os.remove(path)
+end
+
+local function test_open_wav_with_unset_data_size(self)
+    -- The data runs to the end of the file.
+    local data = _pcm16({ 16384, -16384, 8192 })
+    local path = _write_wav('unset_size', _fmt_chunk(_WAVE_FORMAT_PCM, 1, 16), data, false, true)
+    self:_expect_samples_equal(_AudioFileReader.open_wav(path), 1, { { 0.5 }, { -0.5 }, { 0.25 } })
+    os.remove(path)
+end
+
+local function test_read_into_wrapped_audio_data(self)
+    local data = _pcm16({ 1024, 2048, 3072, 4096, 5120, 6144 })
+    local path = _write_wav('read_into', _fmt_chunk(_WAVE_FORMAT_PCM, 1, 16), data)
+    local reader = _AudioFileReader.open_wav(path)
+
+    -- The second block wraps around the end of the 4 samples buffer, which keeps the 4 newest samples in order.
+    local audio_block = _AudioData(4, _AudioDataFormat(1, _SAMPLE_RATE))
+    self.assertEqual(reader:read_into(audio_block, 3), 3)
+    self.assertEqual(reader:read_into(audio_block, 3), 3)
+    self.assertEqual(reader:read_into(audio_block, 3), 0)
+
+    local expected = cv2.Mat.createFromArray({ { 0.09375 }, { 0.125 }, { 0.15625 }, { 0.1875 } }, cv2.CV_32F)
+    self.assertMatAlmostEqual(audio_block.buffer, expected)
+    os.remove(path)
+end
+
+local function test_open_wav_rejects_truncated_header(self)
+    -- The fmt chunk announces 16 bytes but the file ends after 4 of them.
+    local path = _write_file('truncated', 'RIFF' .. _u32(16) .. 'WAVE' .. 'fmt ' .. _u32(16) .. _u16(_WAVE_FORMAT_PCM) .. _u16(1))
+    self.assertFalse(pcall(_AudioFileReader.open_wav, path))
+
+    -- The file ends inside the RIFF header.
+    path = _write_file('truncated', 'RIFF' .. _u32(4))
+    self.assertFalse(pcall(_AudioFileReader.open_wav, path))
+    os.remove(path)
+end
+
+describe("AudioFileReaderTest", function()
+    it("should test_open_wav_pcm16", function()
+        test_open_wav_pcm16(_assert)
+    end)
+
+    it("should test_open_wav_pcm32", function()
+        test_open_wav_pcm32(_assert)
+    end)
+
+    it("should test_open_wav_float", function()
+        test_open_wav_float(_assert)
+    end)
+
+    it("should test_open_wav_extensible", function()
+        test_open_wav_extensible(_assert)
+    end)
+
+    it("should test_open_wav_skips_odd_sized_chunk", function()
+        test_open_wav_skips_odd_sized_chunk(_assert)
+    end)
+
+    it("should test_open_wav_with_unset_data_size", function()
+        test_open_wav_with_unset_data_size(_assert)
+    end)
+
+    it("should test_read_into_wrapped_audio_data", function()
+        test_read_into_wrapped_audio_data(_assert)
+    end)
+
+    it("should test_open_wav_rejects_truncated_header", function()
+        test_open_wav_rejects_truncated_header(_assert)
+    end)
+end)
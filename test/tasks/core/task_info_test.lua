@@ -0,0 +1,102 @@
+#!/usr/bin/env lua
+
+require "busted.runner" ()
+
+package.path = arg[0]:gsub("[^/\\]+%.lua", '?.lua;'):gsub('/', package.config:sub(1, 1)) ..
+        arg[0]:gsub("[^/\\]+%.lua", '../../?.lua;'):gsub('/', package.config:sub(1, 1)) .. package.path
+
+local unpack = table.unpack or unpack ---@diagnostic disable-line: deprecated
+
+local _assert = require("_assert")
+local _proto_utils = require("_proto_utils") ---@diagnostic disable-line: unused-local
+
+local mediapipe_lua = require("mediapipe_lua")
+local mediapipe = mediapipe_lua.mediapipe
+
+local base_options_module = mediapipe.tasks.lua.core.base_options
+local flow_limiter_options_module = mediapipe.tasks.lua.core.flow_limiter_options
+local task_info_module = mediapipe.tasks.lua.core.task_info
+local face_detector = mediapipe.tasks.lua.vision.face_detector
+
+local _BaseOptions = base_options_module.BaseOptions
+local _FlowLimiterOptions = flow_limiter_options_module.FlowLimiterOptions
+local _DropPolicy = _FlowLimiterOptions.DropPolicy
+local _FaceDetectorOptions = face_detector.FaceDetectorOptions
+local _TaskInfo = task_info_module.TaskInfo
+
+local _TASK_GRAPH_NAME = 'mediapipe.tasks.vision.face_detector.FaceDetectorGraph'
+
+function _assert._create_task_info(self) ---@diagnostic disable-line: unused-local
+    local options = _FaceDetectorOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = 'face_detection_short_range.tflite' })),
+    }))
+    return _TaskInfo(mediapipe_lua.kwargs({
+        task_graph = _TASK_GRAPH_NAME,
+        input_streams = { 'IMAGE:image_in', 'NORM_RECT:norm_rect_in' },
+        output_streams = { 'DETECTIONS:detections', 'IMAGE:image_out' },
+        task_options = options:to_pb2(),
+    }))
+end
+
+local function test_generate_graph_config_without_flow_limiting(self)
+    local config = self:_create_task_info():generate_graph_config(false)
+    self.assertLen(config.node, 1)
+    self.assertEqual(config.node[0].calculator, _TASK_GRAPH_NAME)
+end
+
+local function test_generate_graph_config_with_flow_limiter_options(
+    self,
+    flow_limiter_options,
+    expected_max_in_flight,
+    expected_max_in_queue
+)
+    local config = self:_create_task_info():generate_graph_config(true, flow_limiter_options)
+
+    -- The flow limiter is added after the task graph.
+    self.assertLen(config.node, 2)
+    local flow_limiter = config.node[1]
+    self.assertEqual(flow_limiter.calculator, 'FlowLimiterCalculator')
+    self.assertProtoEquals(string.format([[
+        [mediapipe.FlowLimiterCalculatorOptions.ext] {
+            max_in_flight: %d
+            max_in_queue: %d
+        }
+    ]], expected_max_in_flight, expected_max_in_queue), flow_limiter.options)
+end
+
+local function test_generate_graph_config_fails_with_invalid_flow_limiter_options(self, flow_limiter_options)
+    local task_info = self:_create_task_info()
+    self.assertFalse(pcall(function()
+        task_info:generate_graph_config(true, flow_limiter_options)
+    end))
+end
+
+describe("TaskInfoTest", function()
+    it("should test_generate_graph_config_without_flow_limiting", function()
+        test_generate_graph_config_without_flow_limiting(_assert)
+    end)
+
+    for _, args in ipairs({
+        -- The defaults process one frame at a time and keep the latest pending one.
+        { nil, 1, 1 },
+        { _FlowLimiterOptions(), 1, 1 },
+        { _FlowLimiterOptions(mediapipe_lua.kwargs({ max_in_flight = 3, max_in_queue = 2 })), 3, 2 },
+        -- DROP_NEWEST drops the frames arriving while max_in_flight frames are processed.
+        { _FlowLimiterOptions(mediapipe_lua.kwargs({
+            max_in_flight = 2, max_in_queue = 4, drop_policy = _DropPolicy.DROP_NEWEST,
+        })), 2, 0 },
+    }) do
+        it("should test_generate_graph_config_with_flow_limiter_options " .. _, function()
+            test_generate_graph_config_with_flow_limiter_options(_assert, unpack(args, 1, 3))
+        end)
+    end
+
+    for _, flow_limiter_options in ipairs({
+        _FlowLimiterOptions(mediapipe_lua.kwargs({ max_in_flight = 0 })),
+        _FlowLimiterOptions(mediapipe_lua.kwargs({ max_in_queue = -1 })),
+    }) do
+        it("should test_generate_graph_config_fails_with_invalid_flow_limiter_options " .. _, function()
+            test_generate_graph_config_fails_with_invalid_flow_limiter_options(_assert, flow_limiter_options)
+        end)
+    end
+end)
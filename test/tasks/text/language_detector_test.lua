@@ -134,6 +134,26 @@ local function test_detect(self, model_file_type, text, expected_result)
     self:_expect_language_detector_result_correct(text_result, expected_result)
 end
 
+local function test_detect_batch(self, num_workers)
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
+    local options = _LanguageDetectorOptions(mediapipe_lua.kwargs({
+        base_options = base_options, score_threshold = _SCORE_THRESHOLD
+    }))
+    local detector = _LanguageDetector.create_from_options(options)
+
+    -- Results are returned in input order, whatever the instance that detected them.
+    local texts = { _EN_TEXT, _FR_TEXT, _RU_TEXT, _EN_TEXT, _FR_TEXT, _RU_TEXT }
+    local expected_results = {
+        _EN_EXPECTED_RESULT, _FR_EXPECTED_RESULT, _RU_EXPECTED_RESULT,
+        _EN_EXPECTED_RESULT, _FR_EXPECTED_RESULT, _RU_EXPECTED_RESULT,
+    }
+    local results = detector:detect_batch(texts, num_workers)
+    self.assertLen(results, #texts)
+    for i = 1, #texts do
+        self:_expect_language_detector_result_correct(results[i], expected_results[i])
+    end
+end
+
 local function test_allowlist_option(self)
     -- Creates detector.
     local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
@@ -204,6 +224,12 @@ describe("LanguageDetectorTest", function()
         end)
     end
 
+    for _, num_workers in ipairs({ 0, 1, 3 }) do
+        it("should test_detect_batch " .. num_workers, function()
+            test_detect_batch(_assert, num_workers)
+        end)
+    end
+
     it("should test_allowlist_option", function()
         test_allowlist_option(_assert)
     end)
@@ -19,15 +19,20 @@ local test_utils = require("test_utils")
 local mediapipe_lua = require("mediapipe_lua")
 local mediapipe = mediapipe_lua.mediapipe
 
+local opencv_lua = require("opencv_lua")
+local cv2 = opencv_lua.cv
+
 local category = mediapipe.tasks.lua.components.containers.category
 local classification_result_module = mediapipe.tasks.lua.components.containers.classification_result
 local base_options_module = mediapipe.tasks.lua.core.base_options
+local result_cache_options_module = mediapipe.tasks.lua.text.core.result_cache_options
 local text_classifier = mediapipe.tasks.lua.text.text_classifier
 
 local TextClassifierResult = classification_result_module.ClassificationResult
 local _BaseOptions = base_options_module.BaseOptions
 local _Category = category.Category
 local _Classifications = classification_result_module.Classifications
+local _ResultCacheOptions = result_cache_options_module.ResultCacheOptions
 local _TextClassifier = text_classifier.TextClassifier
 local _TextClassifierOptions = text_classifier.TextClassifierOptions
 
@@ -169,6 +174,26 @@ local function test_create_from_options_succeeds_with_valid_model_content(self)
     self.assertIsInstance(classifier, _TextClassifier)
 end
 
+local function test_create_from_options_async_with_warmup(self)
+    -- Creates more classifiers than the creation pool has threads, warmed up before they are returned.
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({
+        model_asset_path = self.model_path,
+        warmup_frames = 2
+    }))
+    local futures = {}
+    for i = 1, 6 do
+        local options = _TextClassifierOptions(mediapipe_lua.kwargs({ base_options = base_options }))
+        futures[i] = _TextClassifier.create_from_options_async(options)
+    end
+
+    for i = 1, 6 do
+        local classifier = futures[i]:get()
+        self.assertTrue(futures[i]:ready())
+        self.assertIsInstance(classifier, _TextClassifier)
+        self.assertProtoEquals(classifier:classify(_NEGATIVE_TEXT):to_pb2(), _BERT_NEGATIVE_RESULTS:to_pb2())
+    end
+end
+
 local function test_classify(self, model_file_type, model_name, text, expected_classification_result)
     local base_options
 
@@ -196,6 +221,105 @@ local function test_classify(self, model_file_type, model_name, text, expected_c
         expected_classification_result:to_pb2())
 end
 
+local function test_classify_batch(self, num_workers)
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
+    local options = _TextClassifierOptions(mediapipe_lua.kwargs({ base_options = base_options }))
+    local classifier = _TextClassifier.create_from_options(options)
+
+    -- Results are returned in input order, whatever the instance that classified them.
+    local texts = {}
+    local expected_results = {}
+    for i = 1, 6 do
+        texts[i] = i % 2 == 1 and _NEGATIVE_TEXT or _POSITIVE_TEXT
+        expected_results[i] = i % 2 == 1 and _BERT_NEGATIVE_RESULTS or _BERT_POSITIVE_RESULTS
+    end
+
+    local results = classifier:classify_batch(texts, num_workers)
+    self.assertLen(results, #texts)
+    for i = 1, #texts do
+        self.assertProtoEquals(results[i]:to_pb2(), expected_results[i]:to_pb2())
+    end
+end
+
+local function test_classify_compact_categories_sized_from_model(self)
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
+    local options = _TextClassifierOptions(mediapipe_lua.kwargs({
+        base_options = base_options,
+        max_results = 1,
+        output_compact_categories = true,
+    }))
+    local classifier = _TextClassifier.create_from_options(options)
+
+    for _, text in ipairs({ _NEGATIVE_TEXT, _POSITIVE_TEXT }) do
+        local result = classifier:classify(text)
+        self.assertLen(result.classifications, 1)
+        self.assertEmpty(result.classifications[1].categories)
+
+        -- The table holds every category of the model, whatever max_results.
+        local compact = result.classifications[1].compact
+        self.assertEqual(compact.scores.rows, 1)
+        self.assertEqual(compact.scores.cols, 2)
+        self.assertListEqual(compact.labels.category_names, { 'negative', 'positive' })
+
+        -- The category that was not returned has a NaN score.
+        self.assertEqual(cv2.countNonZero(cv2.compare(compact.scores, compact.scores, cv2.CMP_EQ)), 1)
+        self.assertLen(compact:to_pb2().classification, 1)
+    end
+end
+
+local function test_classify_with_result_cache(self)
+    -- Creates classifier with a result cache holding a single result.
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
+    local options = _TextClassifierOptions(mediapipe_lua.kwargs({
+        base_options = base_options,
+        result_cache_options = _ResultCacheOptions(mediapipe_lua.kwargs({ capacity = 1 })),
+    }))
+    local classifier = _TextClassifier.create_from_options(options)
+
+    -- Repeated texts are not run through the graph again.
+    self.assertProtoEquals(classifier:classify(_NEGATIVE_TEXT):to_pb2(), _BERT_NEGATIVE_RESULTS:to_pb2())
+    self.assertProtoEquals(classifier:classify(_NEGATIVE_TEXT):to_pb2(), _BERT_NEGATIVE_RESULTS:to_pb2())
+
+    local stats = classifier:result_cache_stats()
+    self.assertEqual(stats.hits, 1)
+    self.assertEqual(stats.misses, 1)
+    self.assertEqual(stats.size, 1)
+
+    -- The least recently used result is evicted.
+    local results = classifier:classify_batch({ _POSITIVE_TEXT, _NEGATIVE_TEXT })
+    self.assertProtoEquals(results[1]:to_pb2(), _BERT_POSITIVE_RESULTS:to_pb2())
+    self.assertProtoEquals(results[2]:to_pb2(), _BERT_NEGATIVE_RESULTS:to_pb2())
+
+    stats = classifier:result_cache_stats()
+    self.assertEqual(stats.hits, 2)
+    self.assertEqual(stats.misses, 2)
+    self.assertEqual(stats.size, 1)
+end
+
+local function test_classify_with_result_cache_returns_new_results(self)
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
+    local options = _TextClassifierOptions(mediapipe_lua.kwargs({
+        base_options = base_options,
+        result_cache_options = _ResultCacheOptions(),
+    }))
+    local classifier = _TextClassifier.create_from_options(options)
+
+    -- Modifies the result of a text before it is cached.
+    local result = classifier:classify(_NEGATIVE_TEXT)
+    local categories = result.classifications[1].categories
+    categories[1].score = 0
+    categories[1].category_name = 'modified'
+
+    -- Modifies the result of a cache hit.
+    result = classifier:classify(_NEGATIVE_TEXT)
+    self.assertProtoEquals(result:to_pb2(), _BERT_NEGATIVE_RESULTS:to_pb2())
+    result.classifications = {}
+
+    -- Cache hits are not affected by the modifications.
+    self.assertProtoEquals(classifier:classify(_NEGATIVE_TEXT):to_pb2(), _BERT_NEGATIVE_RESULTS:to_pb2())
+    self.assertEqual(classifier:result_cache_stats().hits, 2)
+end
+
 describe("TextClassifierTest", function()
     setUp(_assert)
 
@@ -211,6 +335,10 @@ describe("TextClassifierTest", function()
         test_create_from_options_succeeds_with_valid_model_content(_assert)
     end)
 
+    it("should test_create_from_options_async_with_warmup", function()
+        test_create_from_options_async_with_warmup(_assert)
+    end)
+
     for _, args in ipairs({
         { ModelFileType.FILE_NAME,    _BERT_MODEL_FILE,  _NEGATIVE_TEXT, _BERT_NEGATIVE_RESULTS },
         { ModelFileType.FILE_CONTENT, _BERT_MODEL_FILE,  _NEGATIVE_TEXT, _BERT_NEGATIVE_RESULTS },
@@ -225,4 +353,22 @@ describe("TextClassifierTest", function()
             test_classify(_assert, unpack(args))
         end)
     end
+
+    for _, num_workers in ipairs({ 0, 1, 3 }) do
+        it("should test_classify_batch " .. num_workers, function()
+            test_classify_batch(_assert, num_workers)
+        end)
+    end
+
+    it("should test_classify_compact_categories_sized_from_model", function()
+        test_classify_compact_categories_sized_from_model(_assert)
+    end)
+
+    it("should test_classify_with_result_cache", function()
+        test_classify_with_result_cache(_assert)
+    end)
+
+    it("should test_classify_with_result_cache_returns_new_results", function()
+        test_classify_with_result_cache_returns_new_results(_assert)
+    end)
 end)
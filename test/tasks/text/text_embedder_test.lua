@@ -168,6 +168,32 @@ local function test_embed_with_different_themes(self, model_file, expected_simil
     )
 end
 
+local function test_embed_batch(self, quantize, num_workers)
+    -- Creates embedder.
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
+    local options = _TextEmbedderOptions(mediapipe_lua.kwargs({
+        base_options = base_options, quantize = quantize }))
+    local embedder = _TextEmbedder.create_from_options(options)
+
+    local texts = {
+        "it's a charming and often affecting journey",
+        'what a great and fantastic trip',
+        "Let's make a plan to steal the declaration of independence.",
+    }
+
+    local embeddings = embedder:embed_batch(texts, num_workers)
+    self.assertEqual(embeddings.rows, #texts)
+
+    -- Each row is the embedding of the text at the same index.
+    for i, text in ipairs(texts) do
+        local result = embedder:embed(text)
+        local expected = result.embeddings[0 + INDEX_BASE].embedding:reshape(1, 1)
+        self.assertEqual(embeddings.cols, expected.cols)
+        self.assertEqual(embeddings:depth(), expected:depth())
+        self.assertLess(cv2.norm(embeddings:row(i - INDEX_BASE), expected, cv2.NORM_INF), _EPSILON)
+    end
+end
+
 describe("TextEmbedderTest", function()
     setUp(_assert)
 
@@ -253,4 +279,14 @@ describe("TextEmbedderTest", function()
             test_embed_with_different_themes(_assert, unpack(args))
         end)
     end
+
+    for _, args in ipairs({
+        { false, 1 },
+        { false, 2 },
+        { true,  2 },
+    }) do
+        it("should test_embed_batch " .. _, function()
+            test_embed_batch(_assert, unpack(args))
+        end)
+    end
 end)
@@ -25,12 +25,15 @@ local detection_pb2 = mediapipe.framework.formats.detection_pb2
 local image_module = mediapipe.lua._framework_bindings.image
 local detections_module = mediapipe.tasks.lua.components.containers.detections
 local base_options_module = mediapipe.tasks.lua.core.base_options
+local flow_limiter_options_module = mediapipe.tasks.lua.core.flow_limiter_options
 local face_detector = mediapipe.tasks.lua.vision.face_detector
 local image_processing_options_module = mediapipe.tasks.lua.vision.core.image_processing_options
 local running_mode_module = mediapipe.tasks.lua.vision.core.vision_task_running_mode
+local model_asset_registry = mediapipe.lua.model_asset_registry
 
 local FaceDetectorResult = detections_module.DetectionResult
 local _BaseOptions = base_options_module.BaseOptions
+local _FlowLimiterOptions = flow_limiter_options_module.FlowLimiterOptions
 local _Image = image_module.Image
 local _FaceDetector = face_detector.FaceDetector
 local _FaceDetectorOptions = face_detector.FaceDetectorOptions
@@ -108,6 +111,72 @@ local function test_create_from_options_succeeds_with_valid_model_content(self)
     self.assertIsInstance(detector, _FaceDetector)
 end
 
+local function test_create_from_options_shares_model_mapping(self)
+    -- Detectors created on the same model file share the same mapping.
+    model_asset_registry.clear()
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path }))
+    local options = _FaceDetectorOptions(mediapipe_lua.kwargs({ base_options = base_options }))
+    local detectors = {}
+    for i = 1, 3 do
+        detectors[i] = _FaceDetector.create_from_options(options)
+    end
+    self.assertEqual(model_asset_registry.size(), 1)
+
+    -- Running detectors keep their mapping after the registry forgets it.
+    model_asset_registry.clear()
+    self.assertEqual(model_asset_registry.size(), 0)
+    for i = 1, 3 do
+        self.assertLen(detectors[i]:detect(self.test_image).detections, 1)
+    end
+
+    -- Converted options only name the model file, they never point to a mapping.
+    local base_options_proto = base_options:to_pb2()
+    self.assertEqual(base_options_proto.model_asset.file_pointer_meta.pointer, 0)
+    model_asset_registry.clear()
+    self.assertLen(_FaceDetector.create_from_options(options):detect(self.test_image).detections, 1)
+
+    -- The mapping is released with the last detector using it.
+    detectors = nil
+    collectgarbage()
+    collectgarbage()
+    self.assertEqual(model_asset_registry.size(), 0)
+end
+
+local function test_create_from_options_async_with_warmup(self)
+    -- Creates detectors in the background, warmed up before they are returned.
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({
+        model_asset_path = self.model_path,
+        warmup_frames = 2
+    }))
+    local futures = {}
+    for i = 1, 3 do
+        local options = _FaceDetectorOptions(mediapipe_lua.kwargs({ base_options = base_options }))
+        futures[i] = _FaceDetector.create_from_options_async(options)
+    end
+
+    for i = 1, 3 do
+        local detector = futures[i]:get()
+        self.assertTrue(futures[i]:ready())
+        self.assertIsInstance(detector, _FaceDetector)
+        self.assertLen(detector:detect(self.test_image).detections, 1)
+    end
+end
+
+local function test_create_from_options_skips_warmup_in_video_mode(self)
+    -- Video mode detectors are not warmed up, the first frame may have timestamp 0.
+    local base_options = _BaseOptions(mediapipe_lua.kwargs({
+        model_asset_path = self.model_path,
+        warmup_frames = 2
+    }))
+    local options = _FaceDetectorOptions(mediapipe_lua.kwargs({
+        base_options = base_options, running_mode = _RUNNING_MODE.VIDEO
+    }))
+    local detector = _FaceDetector.create_from_options(options)
+    for timestamp = 0, 60, 30 do
+        self.assertLen(detector:detect_for_video(self.test_image, timestamp).detections, 1)
+    end
+end
+
 function _assert._expect_keypoints_correct(self, actual_keypoints, expected_keypoints)
     self.assertLen(actual_keypoints, #expected_keypoints)
     for i = 1, #actual_keypoints do
@@ -328,6 +397,44 @@ local function test_detect_async_calls(
     self.assertEqual(observed_timestamp_ms, 300 - 30)
 end
 
+local function test_detect_async_with_frames_in_flight(self)
+    -- Up to 3 frames run through the graph at once, the frames sent without waiting are queued.
+    local expected_detection_result = _get_expected_face_detector_result(_PORTRAIT_EXPECTED_DETECTION)
+    local observed_timestamps = {}
+
+    local function check_result(
+        result,
+        unused_output_image, ---@diagnostic disable-line: unused-local
+        timestamp_ms
+    )
+        self:_expect_face_detector_results_correct(result, expected_detection_result)
+        if #observed_timestamps > 0 then
+            self.assertLess(observed_timestamps[#observed_timestamps], timestamp_ms)
+        end
+        observed_timestamps[#observed_timestamps + 1] = timestamp_ms
+    end
+
+    local options = _FaceDetectorOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        running_mode = _RUNNING_MODE.LIVE_STREAM,
+        result_callback = check_result,
+        flow_limiter_options = _FlowLimiterOptions(mediapipe_lua.kwargs({ max_in_flight = 3, max_in_queue = 2 })),
+    }))
+    local detector = _FaceDetector.create_from_options(options)
+
+    for timestamp = 0, 300 - 30, 30 do
+        detector:detect_async(self.test_image, timestamp)
+    end
+
+    -- wait for detection end
+    detector:close()
+    mediapipe_lua.notifyCallbacks()
+
+    -- The last frame is never dropped.
+    self.assertGreater(#observed_timestamps, 0)
+    self.assertEqual(observed_timestamps[#observed_timestamps], 300 - 30)
+end
+
 describe("FaceDetectorTest", function()
     setUp(_assert)
 
@@ -339,6 +446,18 @@ describe("FaceDetectorTest", function()
         test_create_from_options_succeeds_with_valid_model_path(_assert)
     end)
 
+    it("should test_create_from_options_shares_model_mapping", function()
+        test_create_from_options_shares_model_mapping(_assert)
+    end)
+
+    it("should test_create_from_options_async_with_warmup", function()
+        test_create_from_options_async_with_warmup(_assert)
+    end)
+
+    it("should test_create_from_options_skips_warmup_in_video_mode", function()
+        test_create_from_options_skips_warmup_in_video_mode(_assert)
+    end)
+
     it("should test_create_from_options_succeeds_with_valid_model_content", function()
         test_create_from_options_succeeds_with_valid_model_content(_assert)
     end)
@@ -433,4 +552,8 @@ describe("FaceDetectorTest", function()
             test_detect_async_calls(_assert, unpack(args))
         end)
     end
+
+    it("should test_detect_async_with_frames_in_flight", function()
+        test_detect_async_with_frames_in_flight(_assert)
+    end)
 end)
@@ -229,6 +229,67 @@ local function test_empty_detection_outputs(self)
     self.assertEmpty(detection_result.facial_transformation_matrixes)
 end
 
+local function test_detect_landmarks_as_mat(self)
+    local options = _FaceLandmarkerOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        output_landmarks_as_mat = true,
+    }))
+    local landmarker = _FaceLandmarker.create_from_options(options)
+    local object_landmarker = _FaceLandmarker.create_from_model_path(self.model_path)
+
+    -- Performs face landmarks detection on the input.
+    local detection_result = landmarker:detect(self.test_image)
+    local object_result = object_landmarker:detect(self.test_image)
+    local expected_face_landmarks = _get_expected_face_landmarks(_PORTRAIT_EXPECTED_FACE_LANDMARKS)
+
+    -- Landmarks are only returned as matrices.
+    self.assertEmpty(detection_result.face_landmarks)
+    self.assertLen(detection_result.face_landmarks_mat, #expected_face_landmarks)
+    self.assertLen(object_result.face_landmarks, #expected_face_landmarks)
+
+    for i = 1, #expected_face_landmarks do
+        local mat = detection_result.face_landmarks_mat[i]
+        self.assertEqual(mat.rows, #expected_face_landmarks[i])
+        self.assertEqual(mat.cols, 5)
+
+        -- One row per landmark: x, y, z, visibility, presence.
+        for j, expected in ipairs(expected_face_landmarks[i]) do
+            local row = j - 1
+            self.assertAlmostEqual(mat[{ row, 0 }], expected.x, mediapipe_lua.kwargs({ delta = _LANDMARKS_MARGIN }))
+            self.assertAlmostEqual(mat[{ row, 1 }], expected.y, mediapipe_lua.kwargs({ delta = _LANDMARKS_MARGIN }))
+
+            local landmark = object_result.face_landmarks[i][j]
+            self.assertAlmostEqual(mat[{ row, 0 }], landmark.x, mediapipe_lua.kwargs({ delta = _LANDMARKS_MARGIN }))
+            self.assertAlmostEqual(mat[{ row, 1 }], landmark.y, mediapipe_lua.kwargs({ delta = _LANDMARKS_MARGIN }))
+            self.assertAlmostEqual(mat[{ row, 2 }], landmark.z, mediapipe_lua.kwargs({ delta = _LANDMARKS_MARGIN }))
+            self.assertAlmostEqual(mat[{ row, 3 }], landmark.visibility, mediapipe_lua.kwargs({ delta = _LANDMARKS_MARGIN }))
+            self.assertAlmostEqual(mat[{ row, 4 }], landmark.presence, mediapipe_lua.kwargs({ delta = _LANDMARKS_MARGIN }))
+        end
+    end
+end
+
+local function test_detect_compact_blendshapes(self)
+    local options = _FaceLandmarkerOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        output_face_blendshapes = true,
+        output_compact_categories = true,
+    }))
+    local landmarker = _FaceLandmarker.create_from_options(options)
+
+    -- Performs face landmarks detection on the input.
+    local detection_result = landmarker:detect(self.test_image)
+
+    -- Blendshapes are only returned as scores indexed by category.
+    self.assertEmpty(detection_result.face_blendshapes)
+    self.assertLen(detection_result.face_blendshapes_compact, 1)
+
+    local blendshapes = detection_result.face_blendshapes_compact[1]
+    self.assertEqual(blendshapes.scores.rows, 1)
+    self.assertEqual(blendshapes.scores.cols, 52)
+    self.assertLen(blendshapes.labels.category_names, 52)
+    self.assertEqual(blendshapes.labels.category_names[1], '_neutral')
+end
+
 local function test_detect_for_video(
     self,
     model_name,
@@ -383,6 +444,14 @@ describe("FaceLandmarkerTest", function()
         test_empty_detection_outputs(_assert)
     end)
 
+    it("should test_detect_landmarks_as_mat", function()
+        test_detect_landmarks_as_mat(_assert)
+    end)
+
+    it("should test_detect_compact_blendshapes", function()
+        test_detect_compact_blendshapes(_assert)
+    end)
+
     for _, args in ipairs({
         {
             _FACE_LANDMARKER_BUNDLE_ASSET_FILE,
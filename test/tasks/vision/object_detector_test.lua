@@ -21,22 +21,32 @@ local mediapipe_lua = require("mediapipe_lua")
 local mediapipe = mediapipe_lua.mediapipe
 local std = mediapipe_lua.std
 
+local opencv_lua = require("opencv_lua")
+local cv2 = opencv_lua.cv
+
 local image_module = mediapipe.lua._framework_bindings.image
+local image_frame = mediapipe.lua._framework_bindings.image_frame
 local bounding_box_module = mediapipe.tasks.lua.components.containers.bounding_box
 local category_module = mediapipe.tasks.lua.components.containers.category
 local detections_module = mediapipe.tasks.lua.components.containers.detections
 local base_options_module = mediapipe.tasks.lua.core.base_options
 local object_detector = mediapipe.tasks.lua.vision.object_detector
 local running_mode_module = mediapipe.tasks.lua.vision.core.vision_task_running_mode
+local tiling_options_module = mediapipe.tasks.lua.vision.core.tiling_options
+local motion_gate_options_module = mediapipe.tasks.lua.vision.core.motion_gate_options
 
 local _BaseOptions = base_options_module.BaseOptions
 local _Category = category_module.Category
 local _BoundingBox = bounding_box_module.BoundingBox
 local _Detection = detections_module.Detection
 local _DetectionResult = detections_module.DetectionResult
+local _DenseDetections = detections_module.DenseDetections
 local _Image = image_module.Image
+local _ImageFormat = image_frame.ImageFormat
 local _ObjectDetector = object_detector.ObjectDetector
 local _ObjectDetectorOptions = object_detector.ObjectDetectorOptions
+local _TilingOptions = tiling_options_module.TilingOptions
+local _MotionGateOptions = motion_gate_options_module.MotionGateOptions
 
 local _RUNNING_MODE = running_mode_module.VisionTaskRunningMode
 
@@ -188,6 +198,103 @@ local function test_detect(
     self.assertEqual(detection_result, expected_detection_result)
 end
 
+local function test_detect_dense(self)
+    local options = _ObjectDetectorOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        max_results = 4,
+        output_dense_detections = true,
+    }))
+    local detector = _ObjectDetector.create_from_options(options)
+
+    -- Performs object detection on the input.
+    local detection_result = detector:detect(self.test_image)
+    local expected_dense = _DenseDetections.create_from_pb2(_EXPECTED_DETECTION_RESULT:to_pb2())
+
+    -- Detections are only returned as matrices.
+    self.assertEmpty(detection_result.detections)
+    self.assertMatEqual(detection_result.dense.boxes, expected_dense.boxes)
+    self.assertMatEqual(detection_result.dense.scores, expected_dense.scores)
+    self.assertMatEqual(detection_result.dense.label_ids, expected_dense.label_ids)
+end
+
+function _assert._expect_tiled_detections_correct(self, detection_result, max_results, left, top, width, height)
+    self.assertNotEmpty(detection_result.detections)
+    self.assertLessEqual(#detection_result.detections, max_results)
+
+    -- Detections of the tiles are merged in the coordinates of the input, best scores first.
+    local previous_score = math.huge
+    for _, detection in ipairs(detection_result.detections) do
+        local bounding_box = detection.bounding_box
+        self.assertGreaterEqual(bounding_box.origin_x, left)
+        self.assertGreaterEqual(bounding_box.origin_y, top)
+        self.assertLessEqual(bounding_box.origin_x + bounding_box.width, left + width + 1)
+        self.assertLessEqual(bounding_box.origin_y + bounding_box.height, top + height + 1)
+
+        local score = detection.categories[INDEX_BASE].score
+        self.assertLessEqual(score, previous_score)
+        previous_score = score
+    end
+end
+
+local function test_detect_tiled(self)
+    local options = _ObjectDetectorOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        max_results = 4,
+        tiling_options = _TilingOptions(mediapipe_lua.kwargs({ tile_size = 320, num_workers = 2 })),
+    }))
+    local detector = _ObjectDetector.create_from_options(options)
+
+    -- Performs object detection on the tiles of the input.
+    -- The full frame alone finds 4 objects, the tiles find more, which are capped to max_results.
+    local detection_result = detector:detect(self.test_image)
+    self.assertLen(detection_result.detections, 4)
+    self:_expect_tiled_detections_correct(detection_result, 4, 0, 0, self.test_image.width, self.test_image.height)
+end
+
+local function test_detect_tiled_finds_small_objects(self)
+    -- The test image at the bottom right of a frame 3 times larger, where its objects are small.
+    local test_image = cv2.cvtColor(cv2.imread(test_utils.get_test_data_path(_IMAGE_FILE)), cv2.COLOR_BGR2RGB)
+    local width = test_image.cols
+    local height = test_image.rows
+    local frame = cv2.copyMakeBorder(test_image, 2 * height, 0, 2 * width, 0, cv2.BORDER_CONSTANT)
+
+    local options = _ObjectDetectorOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        max_results = 4,
+        category_allowlist = _ALLOW_LIST,
+        tiling_options = _TilingOptions(mediapipe_lua.kwargs({ tile_size = 640, overlap = 0.5, num_workers = 2 })),
+    }))
+    local detector = _ObjectDetector.create_from_options(options)
+
+    -- The cats are found on the tiles covering the test image.
+    local detection_result = detector:detect(_Image(_ImageFormat.SRGB, frame))
+    self:_expect_tiled_detections_correct(detection_result, 4, 2 * width, 2 * height, width, height)
+
+    local category_names = {}
+    for _, detection in ipairs(detection_result.detections) do
+        category_names[#category_names + 1] = detection.categories[INDEX_BASE].category_name
+    end
+    self.assertIn('cat', category_names)
+end
+
+local function test_detect_for_video_tiled(self)
+    local options = _ObjectDetectorOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        running_mode = _RUNNING_MODE.VIDEO,
+        max_results = 4,
+        tiling_options = _TilingOptions(mediapipe_lua.kwargs({ tile_size = 320, num_workers = 2 })),
+    }))
+    local detector = _ObjectDetector.create_from_options(options)
+
+    for timestamp = 0, 60, 30 do
+        local detection_result = detector:detect_for_video(self.test_image, timestamp)
+        self.assertLen(detection_result.detections, 4)
+    end
+
+    -- Timestamps must be monotonically increasing, as on the untiled path.
+    self.assertFalse(pcall(detector.detect_for_video, detector, self.test_image, 60))
+end
+
 local function test_score_threshold_option(self)
     local options = _ObjectDetectorOptions(mediapipe_lua.kwargs({
         base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
@@ -307,6 +414,29 @@ local function test_detect_for_video(self)
     end
 end
 
+local function test_detect_for_video_with_motion_gate(self)
+    local options = _ObjectDetectorOptions(mediapipe_lua.kwargs({
+        base_options = _BaseOptions(mediapipe_lua.kwargs({ model_asset_path = self.model_path })),
+        running_mode = _RUNNING_MODE.VIDEO,
+        max_results = 4,
+        motion_gate_options = _MotionGateOptions(mediapipe_lua.kwargs({ max_skipped_frames = 3 })),
+    }))
+    local detector = _ObjectDetector.create_from_options(options)
+
+    -- Identical frames reuse the results of the last processed frame.
+    for timestamp = 0, 300 - 30, 30 do
+        local detection_result = detector:detect_for_video(self.test_image, timestamp)
+        self.assertEqual(detection_result, _EXPECTED_DETECTION_RESULT)
+    end
+
+    -- Every 4th frame is processed again, the 10 frames are processed at 0, 120 and 240.
+    self.assertEqual(detector:get_motion_gate_skipped_frames(), 7)
+
+    -- Without gate, every frame is processed.
+    detector:set_motion_gate_options()
+    self.assertEqual(detector:get_motion_gate_skipped_frames(), 0)
+end
+
 local function test_detect_async_calls(self, threshold, expected_result)
     local observed_timestamp_ms = -1
 
@@ -367,6 +497,22 @@ describe("ObjectDetectorTest", function()
         end)
     end
 
+    it("should test_detect_dense", function()
+        test_detect_dense(_assert)
+    end)
+
+    it("should test_detect_tiled", function()
+        test_detect_tiled(_assert)
+    end)
+
+    it("should test_detect_tiled_finds_small_objects", function()
+        test_detect_tiled_finds_small_objects(_assert)
+    end)
+
+    it("should test_detect_for_video_tiled", function()
+        test_detect_for_video_tiled(_assert)
+    end)
+
     it("should test_score_threshold_option", function()
         test_score_threshold_option(_assert)
     end)
@@ -395,6 +541,10 @@ describe("ObjectDetectorTest", function()
         test_detect_for_video(_assert)
     end)
 
+    it("should test_detect_for_video_with_motion_gate", function()
+        test_detect_for_video_with_motion_gate(_assert)
+    end)
+
     for _, args in ipairs({
         { 0, _EXPECTED_DETECTION_RESULT },
         { 1, _DetectionResult(mediapipe_lua.kwargs({ detections = {} })) }